@@ -0,0 +1,151 @@
+// one parse per request, as a server does it: a fresh allocator per request
+// (ekonAllocatorNew / ekonAllocatorRelease) against one allocator reset in
+// between with each EkonResetPolicy. the requests are mostly small API
+// payloads, some lists of records and a rare bulk upload
+//
+//   gcc -O2 -std=gnu99 arena_bench.c -o arena_bench -pthread && ./arena_bench
+//
+// the library is included whole, with its heap use counted
+#define EKON_MEMORY_NODE 2
+#include "../src/ekon.c"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_REQUESTS 100000
+#define BENCH_ROUNDS 3
+
+static u64 benchSeed = 0x9E3779B97F4A7C15ULL;
+
+u64 benchRand() {
+  benchSeed ^= benchSeed << 13;
+  benchSeed ^= benchSeed >> 7;
+  benchSeed ^= benchSeed << 17;
+  return benchSeed;
+}
+
+f64 benchNow() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// a user record of a REST API
+u32 benchRecord(char *s, u32 id) {
+  return sprintf(s,
+                 "{id: %u, login: user%u, email: 'user%u@example.com', "
+                 "active: %s, score: %u.%02u, tags: [a, b, c], created_at: "
+                 "'2024-03-%02uT10:00:00Z', address: {city: Dhaka, zip: "
+                 "'1%04u'}}",
+                 id, id, id, id % 3 ? "true" : "false", id % 1000, id % 100,
+                 id % 28 + 1, id % 10000);
+}
+
+// an array of `count` records
+char *benchDocument(u32 count, u32 *outLen) {
+  char *s = (char *)malloc(count * 256 + 16);
+  u32 len = sprintf(s, "[\n");
+  for (u32 i = 0; i < count; i++) {
+    len += benchRecord(s + len, (u32)(benchRand() % 1000000));
+    s[len++] = '\n';
+  }
+  len += sprintf(s + len, "]\n");
+  *outLen = len;
+  return s;
+}
+
+// kinds of requests: share of the traffic in percent and records per body
+typedef struct {
+  const char *name;
+  u32 percent;
+  u32 records;
+  char *s;
+  u32 len;
+} BenchKind;
+
+static BenchKind benchKinds[] = {{"single record", 85, 1, 0, 0},
+                                 {"page of 50", 14, 50, 0, 0},
+                                 {"bulk of 2000", 1, 2000, 0, 0}};
+#define BENCH_KINDS (sizeof(benchKinds) / sizeof(benchKinds[0]))
+
+// bytes held by an allocator
+u64 benchHeld(const EkonAllocator *a) {
+  u64 held = 0;
+  for (const EkonANode *n = a->root; n != 0; n = n->next)
+    held += n->size;
+  return held;
+}
+
+// parse every request; policy < 0 for an allocator per request
+void benchRun(const u8 *requests, int policy, const char *name, u64 bytes) {
+  f64 best = 1e9;
+  u32 mallocs = 0;
+  u64 held = 0, maxHeld = 0, sum = 0;
+  for (u32 r = 0; r < BENCH_ROUNDS; r++) {
+    u32 count, size, freed, after;
+    EkonAllocator *a = policy < 0 ? 0 : ekonAllocatorNew();
+    held = maxHeld = 0;
+    ekonMemoryStats(&count, &size, &freed);
+    f64 t = benchNow();
+    for (u32 i = 0; i < BENCH_REQUESTS; i++) {
+      const BenchKind *k = benchKinds + requests[i];
+      if (policy < 0)
+        a = ekonAllocatorNew();
+      EkonValue *v = ekonValueNew(a);
+      if (ekonValueParseLen(v, k->s, k->len, NULL, NULL) == false) {
+        printf("parse error\n");
+        exit(1);
+      }
+      sum += ekonValueSize(v);
+      if (policy < 0) {
+        ekonAllocatorRelease(a);
+      } else {
+        held = benchHeld(a);
+        maxHeld = held > maxHeld ? held : maxHeld;
+        ekonAllocatorReset(a, (EkonResetPolicy)policy);
+      }
+    }
+    t = benchNow() - t;
+    ekonMemoryStats(&after, &size, &freed);
+    mallocs = after - count;
+    if (a != 0 && policy >= 0) {
+      held = benchHeld(a);
+      ekonAllocatorRelease(a);
+    }
+    best = t < best ? t : best;
+  }
+  printf("%-20s %8.1f ns/request %8.1f MB/s %7.3f mallocs/request "
+         "%8.1f KB held (peak %8.1f KB) (checksum %llu)\n",
+         name, best * 1e9 / BENCH_REQUESTS, bytes / best / 1e6,
+         (f64)mallocs / BENCH_REQUESTS, held / 1024.0, maxHeld / 1024.0,
+         (unsigned long long)sum);
+}
+
+int main() {
+  u32 i, k;
+  for (k = 0; k < BENCH_KINDS; k++)
+    benchKinds[k].s = benchDocument(benchKinds[k].records, &benchKinds[k].len);
+
+  // the request mix, the same for every run
+  u8 *requests = (u8 *)malloc(BENCH_REQUESTS);
+  u64 bytes = 0;
+  for (i = 0; i < BENCH_REQUESTS; i++) {
+    u32 x = (u32)(benchRand() % 100);
+    for (k = 0; x >= benchKinds[k].percent; k++)
+      x -= benchKinds[k].percent;
+    requests[i] = (u8)k;
+    bytes += benchKinds[k].len;
+  }
+  for (k = 0; k < BENCH_KINDS; k++)
+    printf("%-14s %3u%% of the requests, %7u bytes\n", benchKinds[k].name,
+           benchKinds[k].percent, benchKinds[k].len);
+
+  benchRun(requests, -1, "new/release", bytes);
+  benchRun(requests, EKON_RESET_KEEP_FIRST, "reset, keep first", bytes);
+  benchRun(requests, EKON_RESET_KEEP_LARGEST, "reset, keep largest", bytes);
+  benchRun(requests, EKON_RESET_KEEP_ALL, "reset, keep all", bytes);
+
+  for (k = 0; k < BENCH_KINDS; k++)
+    free(benchKinds[k].s);
+  free(requests);
+  return 0;
+}
@@ -0,0 +1,142 @@
+// ekonStrToDouble vs strtod and ekonDoubleToStr vs snprintf("%.17g") on the
+// numbers of a canada.json-like document (polygon coordinates with 15
+// decimals) written as EKON.
+//
+//   gcc -O2 -std=gnu99 float_bench.c -o float_bench -pthread && ./float_bench
+//
+// the library is included whole to reach its number conversions
+#include "../src/ekon.c"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_POINTS 111126 // as many numbers as canada.json has
+#define BENCH_ROUNDS 20
+
+static u64 benchSeed = 0x9E3779B97F4A7C15ULL;
+
+u64 benchRand() {
+  benchSeed ^= benchSeed << 13;
+  benchSeed ^= benchSeed >> 7;
+  benchSeed ^= benchSeed << 17;
+  return benchSeed;
+}
+
+f64 benchNow() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// EKON source of a feature collection of a few polygons
+char *benchDocument(u32 *outLen) {
+  const u32 cap = BENCH_POINTS * 48 + 4096;
+  char *s = (char *)malloc(cap);
+  u32 len = sprintf(s, "type: FeatureCollection\nfeatures: [\n");
+  for (u32 p = 0; p < BENCH_POINTS / 2;) {
+    len += sprintf(s + len, "  {\n    type: Feature\n    geometry: {\n"
+                            "      type: Polygon\n      coordinates: [[\n");
+    for (u32 i = 0; i < 4000 && p < BENCH_POINTS / 2; i++, p++) {
+      const f64 lon = -141 + (benchRand() % 89000000000000ULL) * 1e-12;
+      const f64 lat = 41 + (benchRand() % 42000000000000ULL) * 1e-12;
+      len += sprintf(s + len, "        [%.15f, %.15f]\n", lon, lat);
+    }
+    len += sprintf(s + len, "      ]]\n    }\n  }\n");
+  }
+  len += sprintf(s + len, "]\n");
+  *outLen = len;
+  return s;
+}
+
+// every number node under n
+void benchCollect(EkonNode *n, EkonNode **nums, u32 *count) {
+  for (; n != 0; n = n->next) {
+    if (n->ekonType == EKON_TYPE_NUMBER)
+      nums[(*count)++] = n;
+    else if (n->ekonType == EKON_TYPE_ARRAY ||
+             n->ekonType == EKON_TYPE_OBJECT)
+      benchCollect(n->value.node, nums, count);
+  }
+}
+
+int main() {
+  u32 len;
+  char *s = benchDocument(&len);
+  EkonAllocator *a = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(a);
+  char *err = NULL, *schema = NULL;
+  if (ekonValueParseLen(v, s, len, &err, &schema) == false) {
+    printf("parse error: %s\n", err);
+    return 1;
+  }
+
+  EkonNode **nums = (EkonNode **)malloc(BENCH_POINTS * sizeof(EkonNode *));
+  u32 count = 0;
+  u64 bytes = 0;
+  benchCollect(v->n, nums, &count);
+  for (u32 i = 0; i < count; i++)
+    bytes += nums[i]->len;
+
+  // numbers end at ',' or ']', so strtod stops where the node does
+  u32 mismatch = 0;
+  for (u32 i = 0; i < count; i++) {
+    f64 x = 0, y = strtod(nums[i]->value.str, NULL);
+    ekonStrToDouble(nums[i]->value.str, nums[i]->len, &x);
+    mismatch += memcmp(&x, &y, sizeof(x)) != 0;
+  }
+
+  f64 *values = (f64 *)malloc(count * sizeof(f64));
+  for (u32 i = 0; i < count; i++)
+    ekonStrToDouble(nums[i]->value.str, nums[i]->len, values + i);
+
+  f64 sum = 0, best[4] = {1e9, 1e9, 1e9, 1e9};
+  u64 outBytes[2] = {0, 0};
+  char buff[32];
+  for (u32 r = 0; r < BENCH_ROUNDS; r++) {
+    f64 t = benchNow();
+    for (u32 i = 0; i < count; i++)
+      sum += strtod(nums[i]->value.str, NULL);
+    t = benchNow() - t;
+    best[0] = t < best[0] ? t : best[0];
+
+    t = benchNow();
+    for (u32 i = 0; i < count; i++) {
+      f64 d;
+      ekonStrToDouble(nums[i]->value.str, nums[i]->len, &d);
+      sum += d;
+    }
+    t = benchNow() - t;
+    best[1] = t < best[1] ? t : best[1];
+
+    outBytes[0] = outBytes[1] = 0;
+    t = benchNow();
+    for (u32 i = 0; i < count; i++)
+      outBytes[0] += snprintf(buff, sizeof(buff), "%.17g", values[i]);
+    t = benchNow() - t;
+    best[2] = t < best[2] ? t : best[2];
+
+    t = benchNow();
+    for (u32 i = 0; i < count; i++)
+      outBytes[1] += ekonDoubleToStr(values[i], buff);
+    t = benchNow() - t;
+    best[3] = t < best[3] ? t : best[3];
+  }
+
+  printf("%u numbers, %llu bytes, %u mismatches (checksum %g)\n", count,
+         (unsigned long long)bytes, mismatch, sum);
+  const char *names[4] = {"strtod", "ekonStrToDouble", "snprintf %.17g",
+                          "ekonDoubleToStr"};
+  for (u32 i = 0; i < 4; i++)
+    printf("%-16s %8.2f ns/number %8.1f MB/s\n", names[i],
+           best[i] * 1e9 / count,
+           (i < 2 ? bytes : outBytes[i - 2]) / best[i] / 1e6);
+  printf("formatted: %llu bytes with %%.17g, %llu shortest\n",
+         (unsigned long long)outBytes[0], (unsigned long long)outBytes[1]);
+
+  ekonAllocatorRelease(a);
+  free(values);
+  free(nums);
+  free(s);
+  free(err);
+  free(schema);
+  return mismatch != 0;
+}
@@ -0,0 +1,203 @@
+// keymap hash: collisions, probe lengths and throughput on a few sets of
+// object keys. the hash is chosen at build time, so build it once per hash
+//
+//   gcc -O2 -std=gnu99 hashmap_bench.c -o hashmap_bench -pthread
+//   gcc -O2 -std=gnu99 -msse4.2 -DEKON_HASH_CRC32 hashmap_bench.c -o crc
+//
+// the library is included whole to reach its hashmap
+#include "../src/ekon.c"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_ROUNDS 10
+
+static u64 benchSeed = 0x9E3779B97F4A7C15ULL;
+
+u64 benchRand() {
+  benchSeed ^= benchSeed << 13;
+  benchSeed ^= benchSeed >> 7;
+  benchSeed ^= benchSeed << 17;
+  return benchSeed;
+}
+
+f64 benchNow() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// field names of REST APIs, joined in pairs like nested records get
+// flattened: "user_created_at", "repo_html_url"...
+static const char *benchWords[] = {
+    "id",          "name",        "type",       "url",         "html_url",
+    "created_at",  "updated_at",  "user",       "login",       "email",
+    "text",        "description", "title",      "body",        "state",
+    "count",       "size",        "value",      "key",         "status",
+    "owner",       "repo",        "full_name",  "private",     "fork",
+    "language",    "score",       "tags",       "labels",      "items",
+    "data",        "meta",        "links",      "next",        "prev",
+    "first_name",  "last_name",   "address",    "city",        "country",
+    "zip",         "phone",       "avatar_url", "followers",   "following",
+    "screen_name", "location",    "lang",       "timezone",    "verified",
+    "lat",         "lon",         "geometry",   "properties",  "features",
+    "coordinates", "parent_id",   "version",    "checksum",    "timestamp"};
+
+typedef struct {
+  const char *name;
+  char **keys;
+  u32 *lens;
+  u32 count;
+} BenchKeys;
+
+char *benchDup(const char *s, u32 len) {
+  char *d = (char *)malloc(len + 1);
+  memcpy(d, s, len + 1);
+  return d;
+}
+
+void benchAdd(BenchKeys *k, const char *s) {
+  const u32 len = (u32)strlen(s);
+  k->lens[k->count] = len;
+  k->keys[k->count++] = benchDup(s, len);
+}
+
+void benchInit(BenchKeys *k, const char *name, u32 cap) {
+  k->name = name;
+  k->keys = (char **)malloc(cap * sizeof(char *));
+  k->lens = (u32 *)malloc(cap * sizeof(u32));
+  k->count = 0;
+}
+
+// the key sets
+void benchKeySets(BenchKeys *sets) {
+  const u32 words = sizeof(benchWords) / sizeof(benchWords[0]);
+  char buff[128];
+  u32 i, j;
+
+  benchInit(sets + 0, "field names", words * words);
+  for (i = 0; i < words; i++)
+    for (j = 0; j < words; j++) {
+      snprintf(buff, sizeof(buff), "%s_%s", benchWords[i], benchWords[j]);
+      benchAdd(sets + 0, buff);
+    }
+
+  // keys apart by a digit or two, the worst case of a weak hash
+  benchInit(sets + 1, "numbered ids", 200000);
+  for (i = 0; i < 200000; i++) {
+    snprintf(buff, sizeof(buff), "item%u", i);
+    benchAdd(sets + 1, buff);
+  }
+
+  benchInit(sets + 2, "uuids", 100000);
+  for (i = 0; i < 100000; i++) {
+    const u64 x = benchRand(), y = benchRand();
+    snprintf(buff, sizeof(buff), "%08x-%04x-4%03x-a%03x-%012llx",
+             (u32)x, (u32)(x >> 32) & 0xFFFF, (u32)(x >> 48) & 0xFFF,
+             (u32)y & 0xFFF, (unsigned long long)(y >> 16));
+    benchAdd(sets + 2, buff);
+  }
+
+  benchInit(sets + 3, "url paths", 100000);
+  for (i = 0; i < 100000; i++) {
+    snprintf(buff, sizeof(buff), "/api/v2/%s/%u/%s", benchWords[i % words],
+             (u32)(benchRand() % 1000000), benchWords[(i / words) % words]);
+    benchAdd(sets + 3, buff);
+  }
+}
+
+int benchCompare(const void *a, const void *b) {
+  const u32 x = *(const u32 *)a, y = *(const u32 *)b;
+  return x < y ? -1 : x > y;
+}
+
+void benchRun(const BenchKeys *k) {
+  u32 *hashes = (u32 *)malloc(k->count * sizeof(u32));
+  u32 i, r;
+  u64 bytes = 0;
+  for (i = 0; i < k->count; i++) {
+    hashes[i] = ekonHashmapHash(k->keys[i], k->lens[i]);
+    bytes += k->lens[i];
+  }
+
+  // keys sharing their whole 32 bit hash with an earlier one
+  u32 *sorted = (u32 *)malloc(k->count * sizeof(u32));
+  memcpy(sorted, hashes, k->count * sizeof(u32));
+  qsort(sorted, k->count, sizeof(u32), benchCompare);
+  u32 collisions = 0;
+  for (i = 1; i < k->count; i++)
+    collisions += sorted[i] == sorted[i - 1];
+
+  EkonAllocator *a = ekonAllocatorNew();
+  EkonNode *nodes = (EkonNode *)calloc(k->count, sizeof(EkonNode));
+  EkonHashmap m;
+  ekonHashmapInit(a, k->count, &m);
+  for (i = 0; i < k->count; i++)
+    ekonHashmapPut(a, &m, k->keys[i], k->lens[i], hashes[i], nodes + i, NULL);
+
+  // groups probed to find each key, and the slots of those groups with the
+  // same 7 bit control byte that are not the key
+  const u32 groupMask = m.tableSize / HASHMAP_GROUP_WIDTH - 1;
+  u64 groups = 0, tagMatches = 0;
+  for (i = 0; i < k->count; i++) {
+    const u32 index = ekonHashmapFind(&m, k->keys[i], k->lens[i], hashes[i]);
+    u32 group = (hashes[i] >> 7) & groupMask, step = 1;
+    for (;; group = (group + step++) & groupMask) {
+      const u8 *ctrl = m.ctrl + group * HASHMAP_GROUP_WIDTH;
+      groups++;
+      tagMatches += __builtin_popcount(
+          ekonHashmapGroupMatch(ctrl, (u8)(hashes[i] & 0x7F)));
+      if (index / HASHMAP_GROUP_WIDTH == group)
+        break;
+    }
+    tagMatches--;
+  }
+
+  f64 best[2] = {1e9, 1e9};
+  u32 sum = 0;
+  for (r = 0; r < BENCH_ROUNDS; r++) {
+    f64 t = benchNow();
+    for (i = 0; i < k->count; i++)
+      sum += ekonHashmapHash(k->keys[i], k->lens[i]);
+    t = benchNow() - t;
+    best[0] = t < best[0] ? t : best[0];
+
+    t = benchNow();
+    for (i = 0; i < k->count; i++)
+      sum += ekonHashmapGet(&m, k->keys[i], k->lens[i],
+                            ekonHashmapHash(k->keys[i], k->lens[i])) != NULL;
+    t = benchNow() - t;
+    best[1] = t < best[1] ? t : best[1];
+  }
+
+  printf("%-13s %7u keys %5.1f B/key %6u collisions %5.3f groups/get "
+         "%5.3f tag hits/get | hash %6.2f ns/key %6.2f GB/s | get %6.2f "
+         "ns/key (checksum %u)\n",
+         k->name, k->count, (f64)bytes / k->count, collisions,
+         (f64)groups / k->count, (f64)tagMatches / k->count,
+         best[0] * 1e9 / k->count, bytes / best[0] / 1e9,
+         best[1] * 1e9 / k->count, sum);
+
+  ekonAllocatorRelease(a);
+  free(nodes);
+  free(sorted);
+  free(hashes);
+}
+
+int main() {
+  BenchKeys sets[4];
+  u32 i, j;
+  benchKeySets(sets);
+#if defined(EKON_HASH_CRC32)
+  printf("hash: crc32 + mix\n");
+#else
+  printf("hash: wyhash style\n");
+#endif
+  for (i = 0; i < 4; i++) {
+    benchRun(sets + i);
+    for (j = 0; j < sets[i].count; j++)
+      free(sets[i].keys[j]);
+    free(sets[i].keys);
+    free(sets[i].lens);
+  }
+  return 0;
+}
@@ -18,9 +18,10 @@
 
 // ---INCLUDES--
 #include "ekon.h"
+#include <limits.h> // import INT_MIN, INT_MAX, LONG_MIN, LONG_MAX
 #include <stdio.h>  // import snprintf
 #include <stdlib.h> // import atof, atoi, atol, atoll, malloc, free
-#include <string.h> // import memcpy, strcmp
+#include <string.h> // import memchr, memcpy, strcmp
 
 // ---- MACROS -----
 #if defined(_MSC_VER)
@@ -39,6 +40,27 @@
 #include <nmmintrin.h>
 #endif
 
+// SIMD level used by the structural indexer (stage 1 of the parser)
+#if defined(__AVX2__)
+#define EKON_SIMD_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define EKON_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// worker threads of ekonValueParseParallel. without them (EKON_NO_THREADS or
+// no pthreads) the slices of a source are parsed one after the other
+#if !defined(EKON_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define EKON_THREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 #if defined(_MSC_VER)
 #pragma warning(pop)
 #endif
@@ -62,9 +84,20 @@
 #define HASHMAP_USED
 #endif
 
-// max chain length
-#define HASHMAP_MAX_CHAIN_LENGTH (8)
+// slots whose control bytes are matched at once
+#define HASHMAP_GROUP_WIDTH (16)
+// control bytes of the slots without a key. a used slot has the low 7 bits
+// of its key's hash, so the high bit tells the free slots apart
+#define HASHMAP_CTRL_EMPTY (0x80)
+#define HASHMAP_CTRL_DELETED (0xFE)
+// key hash of the keymaps. the default reads the key 8 bytes at a time and
+// mixes with 64x64->128 bit products (wyhash style). EKON_HASH_CRC32 selects
+// the crc32 of the key, 8 bytes a step with SSE 4.2, and a 32 bit mix
+#if !defined(EKON_HASH_CRC32)
+#define EKON_HASH_WY
+#endif
 #define u32 uint32_t
+#define u64 uint64_t
 #define i8 int8_t
 
 #ifndef EKON_EXPECT_MODE
@@ -81,6 +114,19 @@
 #define EKON_UNLIKELY(x) x
 #endif
 
+// vectorized scanners read whole aligned blocks, which may start before the
+// source or end in EKON_PADDING
+#if defined(__GNUC__)
+#define EKON_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#define EKON_NO_SANITIZE_ADDRESS
+#endif
+
+// dispatch on the token kind with a jump table of labels
+#if defined(__GNUC__) && !defined(EKON_NO_COMPUTED_GOTO)
+#define EKON_COMPUTED_GOTO
+#endif
+
 // some casting MACROS
 #define HASHMAP_CAST(type, x) ((type)x)
 #define HASHMAP_PTR_CAST(type, x) ((type)x)
@@ -89,13 +135,17 @@
 // 3. Hashmap implementation
 // ----------------------------------------------------------
 
+// count trailing zeros, for the match masks of the control bytes
+u32 ekonCtz64(u64 x);
+// full 64x64->128 bit product, for the key hash
+u64 ekonMul128(u64 a, u64 b, u64 *outHigh);
+
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
 /// @brief Create a hashmap
-/// @param initSize The initial size of the hashmap. Power of 2 otherwise
-/// error
+/// @param initSize The number of keys it should hold without growing
 /// @param outHashmap The storage for the created hashmap. Allocate this
 /// @return On success `true` is returned
 static bool ekonHashmapInit(EkonAllocator *a, const u32 initSize,
@@ -105,30 +155,33 @@ static bool ekonHashmapInit(EkonAllocator *a, const u32 initSize,
 /// @param hashmap - The hashmap to insert into
 /// @param key - String key - not copied
 /// @param len - The length of the string key
+/// @param hash - ekonHashmapHash of the key
 /// @param value - the value to insert
 /// @param addr - the address where to store the address of the value
 /// @return On success `true` is return
 static bool ekonHashmapPut(EkonAllocator *a, EkonHashmap *const m,
                            const char *const key, const u32 len,
-                           EkonNode *const value,
+                           const u32 hash, EkonNode *const value,
                            EkonHashmapItem **addr) HASHMAP_USED;
 
 /// @brief Get an element from the hashmap
 /// @param hashmap The hashmap to get from
 /// @param key The string key to use
 /// @param len The length of the string key
+/// @param hash ekonHashmapHash of the key
 /// @return (EkonNode* | NULL - not found) The previously set element
 static EkonNode *ekonHashmapGet(const EkonHashmap *const hashmap,
-                                const char *const key,
-                                const u32 len) HASHMAP_USED;
+                                const char *const key, const u32 len,
+                                const u32 hash) HASHMAP_USED;
 
 /// @brief Remove an element from the hashmap
 /// @param m The hashmap to remove from
 /// @param key The string key to use
 /// @param len The length of the string key
+/// @param hash ekonHashmapHash of the key
 /// @return On success `true` is returned
 static bool ekonHashmapRemove(EkonHashmap *const hashmap, const char *const key,
-                              const u32 len) HASHMAP_USED;
+                              const u32 len, const u32 hash) HASHMAP_USED;
 
 /// @brief Iterate over all the elements in a hashmap.
 /// @param `hashmap` The hashmap to iterate over.
@@ -159,19 +212,32 @@ static bool ekonHashmapIteratePairs(EkonAllocator *a,
 /// @return The size of the hashmap
 static u32 ekonHashmapNumEntries(const EkonHashmap *const hashmap) HASHMAP_USED;
 
+#if defined(EKON_HASH_CRC32)
+static u32 ekonHashmapCrc32Step(const u32 crc32val,
+                                const u8 c) HASHMAP_USED;
 static u32 ekonHashmapCrc32Helper(const char *const s,
                                   const u32 len) HASHMAP_USED;
-static u32 ekonHashmapHashHelperIntHelper(const EkonHashmap *const m,
-                                          const char *const keystring,
-                                          const unsigned len) HASHMAP_USED;
+static u32 ekonHashmapMix(u32 key) HASHMAP_USED;
+#else
+static u32 ekonHashmapWyHash(const char *const s, const u32 len) HASHMAP_USED;
+#endif
+/// hash of a key, see EKON_HASH_WY
+static u32 ekonHashmapHash(const char *const keystring,
+                           const unsigned len) HASHMAP_USED;
 static bool ekonHashmapMatchHelper(const EkonHashmapItem *const element,
                                    const char *const key,
                                    const u32 len) HASHMAP_USED;
-static bool ekonHashmapHashHelper(const EkonHashmap *const m,
-                                  const char *const key, const u32 len,
-                                  u32 *const outIndex) HASHMAP_USED;
-static i8 ekonHashmapRehashIterator(EkonAllocator *a, void *const newHash,
-                                    EkonHashmapItem *const e) HASHMAP_USED;
+/// bit i is set when control byte i of the group at `ctrl` is `b`
+static u32 ekonHashmapGroupMatch(const u8 *const ctrl,
+                                 const u8 b) HASHMAP_USED;
+/// bit i is set when slot i of the group at `ctrl` is empty or deleted
+static u32 ekonHashmapGroupMatchFree(const u8 *const ctrl) HASHMAP_USED;
+static u32 ekonHashmapFind(const EkonHashmap *const m, const char *const key,
+                           const u32 len, const u32 hash) HASHMAP_USED;
+static u32 ekonHashmapFindFree(const EkonHashmap *const m,
+                               const u32 hash) HASHMAP_USED;
+static void ekonHashmapErase(EkonHashmap *const m,
+                             const u32 index) HASHMAP_USED;
 static bool ekonHashmapRehashHelper(EkonAllocator *a,
                                     EkonHashmap *const m) HASHMAP_USED;
 #if defined(__cplusplus)
@@ -180,97 +246,88 @@ static bool ekonHashmapRehashHelper(EkonAllocator *a,
 
 bool ekonHashmapInit(EkonAllocator *a, const u32 initSize,
                      EkonHashmap *const outHashmap) {
-  if (initSize == 0 || (initSize & (initSize - 1)) != 0)
-    return false;
+  // keys take at most 7/8 of the slots
+  u32 tableSize = HASHMAP_GROUP_WIDTH;
+  while (tableSize - tableSize / 8 < initSize) {
+    if (tableSize > UINT32_MAX / 2 / (sizeof(EkonHashmapItem) + 1))
+      return false;
+    tableSize *= 2;
+  }
 
-  outHashmap->data =
-      HASHMAP_CAST(EkonHashmapItem *,
-                   ekonAllocatorAlloc(a, initSize * sizeof(EkonHashmapItem)));
-  if (!outHashmap->data) {
+  // the slots, then a control byte per slot
+  char *mem =
+      ekonAllocatorAlloc(a, tableSize * (sizeof(EkonHashmapItem) + 1));
+  if (!mem) {
     return false;
   }
-  outHashmap->tableSize = initSize;
+  outHashmap->data = HASHMAP_CAST(EkonHashmapItem *, mem);
+  outHashmap->ctrl =
+      HASHMAP_CAST(u8 *, mem + tableSize * sizeof(EkonHashmapItem));
+  memset(outHashmap->ctrl, HASHMAP_CTRL_EMPTY, tableSize);
+  outHashmap->tableSize = tableSize;
   outHashmap->size = 0;
+  outHashmap->growthLeft = tableSize - tableSize / 8;
+  outHashmap->shadowed = 0;
   return true;
 }
 
 bool ekonHashmapPut(EkonAllocator *a, EkonHashmap *const m,
-                    const char *const key, const u32 len, EkonNode *const value,
-                    EkonHashmapItem **addr) {
-  u32 index;
-
-  // Find a place to put our value
-  while (ekonHashmapHashHelper(m, key, len, &index) == true) {
-    if (ekonHashmapRehashHelper(a, m) == false)
-      return false;
+                    const char *const key, const u32 len, const u32 hash,
+                    EkonNode *const value, EkonHashmapItem **addr) {
+  u32 index = ekonHashmapFind(m, key, len, hash);
+
+  if (index == m->tableSize) {
+    index = ekonHashmapFindFree(m, hash);
+    // taking a deleted slot leaves the empty ones to end the probes
+    if (m->ctrl[index] == HASHMAP_CTRL_EMPTY) {
+      if (EKON_UNLIKELY(m->growthLeft == 0)) {
+        if (ekonHashmapRehashHelper(a, m) == false)
+          return false;
+        index = ekonHashmapFindFree(m, hash);
+      }
+      m->growthLeft--;
+    }
+    m->ctrl[index] = HASHMAP_CAST(u8, hash & 0x7F);
+    m->size++;
   }
 
   // Set the data
   m->data[index].value = value;
   m->data[index].key = key;
   m->data[index].keyLen = len;
+  m->data[index].hash = hash;
 
-  if (addr != NULL && *addr != NULL)
+  if (addr != NULL)
     *addr = m->data + index;
-
-  // If the hashmap element was not already in use, set that is being
-  //    used and bump size
-  if (m->data[index].inUse == false) {
-    m->data[index].inUse = true;
-    m->size++;
-  }
   return true;
 }
 
 EkonNode *ekonHashmapGet(const EkonHashmap *const m, const char *const key,
-                         const u32 len) {
-  u32 curr;
-  u32 i;
-  // Find the data structure
-  curr = ekonHashmapHashHelperIntHelper(m, key, len);
-  // linear probing, if necessary
-  for (i = 0; i < HASHMAP_MAX_CHAIN_LENGTH; i++) {
-    if (m->data[curr].inUse) {
-      if (ekonHashmapMatchHelper(&m->data[curr], key, len)) {
-        return m->data[curr].value;
-      }
-    }
-    curr = (curr + 1) % m->tableSize;
-  }
-  return NULL; // not found
+                         const u32 len, const u32 hash) {
+  const u32 index = ekonHashmapFind(m, key, len, hash);
+  if (index == m->tableSize)
+    return NULL; // not found
+  return m->data[index].value;
 }
 
 bool ekonHashmapRemove(EkonHashmap *const m, const char *const key,
-                       const u32 len) {
-  u32 i;
-  u32 curr;
-
-  // Find key
-  curr = ekonHashmapHashHelperIntHelper(m, key, len);
-
-  // linear probing if necessary
-  for (i = 0; i < HASHMAP_MAX_CHAIN_LENGTH; i++) {
-    if (m->data[curr].inUse) {
-      if (ekonHashmapMatchHelper(&m->data[curr], key, len)) {
-        // blank out the fields including `inUse`
-        memset(&m->data[curr], 0, sizeof(EkonHashmapItem));
-        m->size--;
-        return true;
-      }
-    }
-    curr = (curr + 1) % m->tableSize;
-  }
-  return false;
+                       const u32 len, const u32 hash) {
+  const u32 index = ekonHashmapFind(m, key, len, hash);
+  if (index == m->tableSize)
+    return false;
+  ekonHashmapErase(m, index);
+  return true;
 }
 
 bool ekonHashmapIterate(const EkonHashmap *const m,
                         bool (*f)(void *const context, EkonNode *const value),
                         void *const context) {
-  u32 i;
-  // Linear probing
-  for (i = 0; i < m->tableSize; i++) {
-    if (m->data[i].inUse) {
-      if (f(context, m->data[i].value) == false) {
+  u32 group;
+  // a group at a time, skipping the free slots by their control bytes
+  for (group = 0; group < m->tableSize; group += HASHMAP_GROUP_WIDTH) {
+    u32 full = ~ekonHashmapGroupMatchFree(m->ctrl + group) & 0xFFFF;
+    for (; full != 0; full &= full - 1) {
+      if (f(context, m->data[group + ekonCtz64(full)].value) == false) {
         return false;
       }
     }
@@ -282,18 +339,14 @@ bool ekonHashmapIteratePairs(EkonAllocator *a, EkonHashmap *const hashmap,
                              i8 (*f)(EkonAllocator *, void *const,
                                      EkonHashmapItem *const),
                              void *const context) {
-  u32 i;
-  struct hashmap_element_s *p;
-  i8 r;
-  // Linear probing
-  for (i = 0; i < hashmap->tableSize; i++) {
-    p = &hashmap->data[i];
-    if (p->inUse) {
-      r = f(a, context, p);
-      switch (r) {
+  u32 group;
+  for (group = 0; group < hashmap->tableSize; group += HASHMAP_GROUP_WIDTH) {
+    u32 full = ~ekonHashmapGroupMatchFree(hashmap->ctrl + group) & 0xFFFF;
+    for (; full != 0; full &= full - 1) {
+      const u32 index = group + ekonCtz64(full);
+      switch (f(a, context, &hashmap->data[index])) {
       case -1: // remove item
-        memset(p, 0, sizeof(EkonHashmapItem));
-        hashmap->size--;
+        ekonHashmapErase(hashmap, index);
         break;
       case 1: // continue iterating
         break;
@@ -307,86 +360,98 @@ bool ekonHashmapIteratePairs(EkonAllocator *a, EkonHashmap *const hashmap,
 
 u32 ekonHashmapNumEntries(const EkonHashmap *const m) { return m->size; }
 
-u32 ekonHashmapCrc32Helper(const char *const s, const u32 len) {
-  u32 i;
-  u32 crc32val = 0;
+#if defined(EKON_HASH_CRC32) && !defined(HASHMAP_SSE42)
+// Using polynomial 0x11EDC6F41 to
+// match SSE 4.2's crc function.
+static const u32 ekonHashmapCrc32Table[] = {
+    0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU,
+    0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU, 0x8AD958CFU, 0x78B2DBCCU,
+    0x6BE22838U, 0x9989AB3BU, 0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U,
+    0x5E133C24U, 0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU,
+    0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U, 0x9A879FA0U,
+    0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU,
+    0xBC267848U, 0x4E4DFB4BU, 0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U,
+    0x33ED7D2AU, 0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
+    0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU,
+    0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU, 0x30E349B1U, 0xC288CAB2U,
+    0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU, 0x1642AE59U,
+    0xE4292D5AU, 0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU,
+    0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U, 0x417B1DBCU,
+    0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U,
+    0x67DAFA54U, 0x95B17957U, 0xCBA24573U, 0x39C9C670U, 0x2A993584U,
+    0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
+    0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U, 0x96BF4DCCU,
+    0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U, 0xDBFC821CU, 0x2997011FU,
+    0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U,
+    0x0F36E6F7U, 0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U,
+    0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U, 0xEB1FCBADU,
+    0x197448AEU, 0x0A24BB5AU, 0xF84F3859U, 0x2C855CB2U, 0xDEEEDFB1U,
+    0xCDBE2C45U, 0x3FD5AF46U, 0x7198540DU, 0x83F3D70EU, 0x90A324FAU,
+    0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
+    0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU,
+    0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U, 0x82F63B78U, 0x709DB87BU,
+    0x63CD4B8FU, 0x91A6C88CU, 0x456CAC67U, 0xB7072F64U, 0xA457DC90U,
+    0x563C5F93U, 0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U,
+    0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU, 0x92A8FC17U,
+    0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU,
+    0xB4091BFFU, 0x466298FCU, 0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU,
+    0x0B21572CU, 0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
+    0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U, 0x65D122B9U,
+    0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU, 0x2892ED69U, 0xDAF96E6AU,
+    0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U, 0x0E330A81U,
+    0xFC588982U, 0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU,
+    0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U, 0x38CC2A06U,
+    0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU,
+    0x1E6DCDEEU, 0xEC064EEDU, 0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U,
+    0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
+    0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU, 0x8ECEE914U,
+    0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U, 0xD3D3E1ABU, 0x21B862A8U,
+    0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U,
+    0x07198540U, 0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U,
+    0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU, 0xE330A81AU,
+    0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU, 0x24AA3F05U, 0xD6C1BC06U,
+    0xC5914FF2U, 0x37FACCF1U, 0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U,
+    0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
+    0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU,
+    0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU, 0x79B737BAU, 0x8BDCB4B9U,
+    0x988C474DU, 0x6AE7C44EU, 0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U,
+    0xAD7D5351U};
+#endif
 
+#if defined(EKON_HASH_CRC32)
+u32 ekonHashmapCrc32Step(const u32 crc32val, const u8 c) {
 #if defined(HASHMAP_SSE42)
-  for (i = 0; i < len; i++) {
-    crc32val = _mm_crc32_u8(crc32val, HASHMAP_CAST(u32 char, s[i]));
-  }
-
-  return crc32val;
+  return _mm_crc32_u8(crc32val, c);
 #else
-  // Using polynomial 0x11EDC6F41 to
-  // match SSE 4.2's crc function.
-  static const u32 crc32_tab[] = {
-      0x00000000U, 0xF26B8303U, 0xE13B70F7U, 0x1350F3F4U, 0xC79A971FU,
-      0x35F1141CU, 0x26A1E7E8U, 0xD4CA64EBU, 0x8AD958CFU, 0x78B2DBCCU,
-      0x6BE22838U, 0x9989AB3BU, 0x4D43CFD0U, 0xBF284CD3U, 0xAC78BF27U,
-      0x5E133C24U, 0x105EC76FU, 0xE235446CU, 0xF165B798U, 0x030E349BU,
-      0xD7C45070U, 0x25AFD373U, 0x36FF2087U, 0xC494A384U, 0x9A879FA0U,
-      0x68EC1CA3U, 0x7BBCEF57U, 0x89D76C54U, 0x5D1D08BFU, 0xAF768BBCU,
-      0xBC267848U, 0x4E4DFB4BU, 0x20BD8EDEU, 0xD2D60DDDU, 0xC186FE29U,
-      0x33ED7D2AU, 0xE72719C1U, 0x154C9AC2U, 0x061C6936U, 0xF477EA35U,
-      0xAA64D611U, 0x580F5512U, 0x4B5FA6E6U, 0xB93425E5U, 0x6DFE410EU,
-      0x9F95C20DU, 0x8CC531F9U, 0x7EAEB2FAU, 0x30E349B1U, 0xC288CAB2U,
-      0xD1D83946U, 0x23B3BA45U, 0xF779DEAEU, 0x05125DADU, 0x1642AE59U,
-      0xE4292D5AU, 0xBA3A117EU, 0x4851927DU, 0x5B016189U, 0xA96AE28AU,
-      0x7DA08661U, 0x8FCB0562U, 0x9C9BF696U, 0x6EF07595U, 0x417B1DBCU,
-      0xB3109EBFU, 0xA0406D4BU, 0x522BEE48U, 0x86E18AA3U, 0x748A09A0U,
-      0x67DAFA54U, 0x95B17957U, 0xCBA24573U, 0x39C9C670U, 0x2A993584U,
-      0xD8F2B687U, 0x0C38D26CU, 0xFE53516FU, 0xED03A29BU, 0x1F682198U,
-      0x5125DAD3U, 0xA34E59D0U, 0xB01EAA24U, 0x42752927U, 0x96BF4DCCU,
-      0x64D4CECFU, 0x77843D3BU, 0x85EFBE38U, 0xDBFC821CU, 0x2997011FU,
-      0x3AC7F2EBU, 0xC8AC71E8U, 0x1C661503U, 0xEE0D9600U, 0xFD5D65F4U,
-      0x0F36E6F7U, 0x61C69362U, 0x93AD1061U, 0x80FDE395U, 0x72966096U,
-      0xA65C047DU, 0x5437877EU, 0x4767748AU, 0xB50CF789U, 0xEB1FCBADU,
-      0x197448AEU, 0x0A24BB5AU, 0xF84F3859U, 0x2C855CB2U, 0xDEEEDFB1U,
-      0xCDBE2C45U, 0x3FD5AF46U, 0x7198540DU, 0x83F3D70EU, 0x90A324FAU,
-      0x62C8A7F9U, 0xB602C312U, 0x44694011U, 0x5739B3E5U, 0xA55230E6U,
-      0xFB410CC2U, 0x092A8FC1U, 0x1A7A7C35U, 0xE811FF36U, 0x3CDB9BDDU,
-      0xCEB018DEU, 0xDDE0EB2AU, 0x2F8B6829U, 0x82F63B78U, 0x709DB87BU,
-      0x63CD4B8FU, 0x91A6C88CU, 0x456CAC67U, 0xB7072F64U, 0xA457DC90U,
-      0x563C5F93U, 0x082F63B7U, 0xFA44E0B4U, 0xE9141340U, 0x1B7F9043U,
-      0xCFB5F4A8U, 0x3DDE77ABU, 0x2E8E845FU, 0xDCE5075CU, 0x92A8FC17U,
-      0x60C37F14U, 0x73938CE0U, 0x81F80FE3U, 0x55326B08U, 0xA759E80BU,
-      0xB4091BFFU, 0x466298FCU, 0x1871A4D8U, 0xEA1A27DBU, 0xF94AD42FU,
-      0x0B21572CU, 0xDFEB33C7U, 0x2D80B0C4U, 0x3ED04330U, 0xCCBBC033U,
-      0xA24BB5A6U, 0x502036A5U, 0x4370C551U, 0xB11B4652U, 0x65D122B9U,
-      0x97BAA1BAU, 0x84EA524EU, 0x7681D14DU, 0x2892ED69U, 0xDAF96E6AU,
-      0xC9A99D9EU, 0x3BC21E9DU, 0xEF087A76U, 0x1D63F975U, 0x0E330A81U,
-      0xFC588982U, 0xB21572C9U, 0x407EF1CAU, 0x532E023EU, 0xA145813DU,
-      0x758FE5D6U, 0x87E466D5U, 0x94B49521U, 0x66DF1622U, 0x38CC2A06U,
-      0xCAA7A905U, 0xD9F75AF1U, 0x2B9CD9F2U, 0xFF56BD19U, 0x0D3D3E1AU,
-      0x1E6DCDEEU, 0xEC064EEDU, 0xC38D26C4U, 0x31E6A5C7U, 0x22B65633U,
-      0xD0DDD530U, 0x0417B1DBU, 0xF67C32D8U, 0xE52CC12CU, 0x1747422FU,
-      0x49547E0BU, 0xBB3FFD08U, 0xA86F0EFCU, 0x5A048DFFU, 0x8ECEE914U,
-      0x7CA56A17U, 0x6FF599E3U, 0x9D9E1AE0U, 0xD3D3E1ABU, 0x21B862A8U,
-      0x32E8915CU, 0xC083125FU, 0x144976B4U, 0xE622F5B7U, 0xF5720643U,
-      0x07198540U, 0x590AB964U, 0xAB613A67U, 0xB831C993U, 0x4A5A4A90U,
-      0x9E902E7BU, 0x6CFBAD78U, 0x7FAB5E8CU, 0x8DC0DD8FU, 0xE330A81AU,
-      0x115B2B19U, 0x020BD8EDU, 0xF0605BEEU, 0x24AA3F05U, 0xD6C1BC06U,
-      0xC5914FF2U, 0x37FACCF1U, 0x69E9F0D5U, 0x9B8273D6U, 0x88D28022U,
-      0x7AB90321U, 0xAE7367CAU, 0x5C18E4C9U, 0x4F48173DU, 0xBD23943EU,
-      0xF36E6F75U, 0x0105EC76U, 0x12551F82U, 0xE03E9C81U, 0x34F4F86AU,
-      0xC69F7B69U, 0xD5CF889DU, 0x27A40B9EU, 0x79B737BAU, 0x8BDCB4B9U,
-      0x988C474DU, 0x6AE7C44EU, 0xBE2DA0A5U, 0x4C4623A6U, 0x5F16D052U,
-      0xAD7D5351U};
-
-  for (i = 0; i < len; i++) {
-    crc32val = crc32_tab[(HASHMAP_CAST(unsigned char, crc32val) ^
-                          HASHMAP_CAST(unsigned char, s[i]))] ^
-               (crc32val >> 8);
+  return ekonHashmapCrc32Table[HASHMAP_CAST(u8, crc32val) ^ c] ^
+         (crc32val >> 8);
+#endif
+}
+
+u32 ekonHashmapCrc32Helper(const char *const s, const u32 len) {
+  u32 i = 0;
+  u32 crc32val = 0;
+#if defined(HASHMAP_SSE42) && (defined(__x86_64__) || defined(_M_X64))
+  // the same crc as byte steps, 8 bytes at a time
+  u64 crc64 = 0;
+  for (; i + 8 <= len; i += 8) {
+    u64 w;
+    memcpy(&w, s + i, 8);
+    crc64 = _mm_crc32_u64(crc64, w);
+  }
+  crc32val = HASHMAP_CAST(u32, crc64);
+#endif
+  for (; i < len; i++) {
+    crc32val = ekonHashmapCrc32Step(crc32val, HASHMAP_CAST(u8, s[i]));
   }
   return crc32val;
-#endif
 }
 
-u32 ekonHashmapHashHelperIntHelper(const EkonHashmap *const m,
-                                   const char *const keyString, const u32 len) {
-  u32 key = ekonHashmapCrc32Helper(keyString, len);
+u32 ekonHashmapHash(const char *const keyString, const u32 len) {
+  return ekonHashmapMix(ekonHashmapCrc32Helper(keyString, len));
+}
 
+u32 ekonHashmapMix(u32 key) {
   // Robert Jenkins' 32 bit Mix Function
   key += (key << 12);
   key ^= (key >> 22);
@@ -400,80 +465,204 @@ u32 ekonHashmapHashHelperIntHelper(const EkonHashmap *const m,
   /* Knuth's Multiplicative Method */
   key = (key >> 3) * 2654435761;
 
-  return key % m->tableSize;
+  return key;
+}
+#else
+// wyhash's secrets
+static const u64 ekonHashmapSecret[3] = {
+    0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL, 0x8ebc6af09c88c6e3ULL};
+
+// 128 bit product of a and b, folded to 64 bits
+static inline u64 ekonHashmapMum(const u64 a, const u64 b) {
+  u64 high;
+  const u64 low = ekonMul128(a, b, &high);
+  return low ^ high;
+}
+
+static inline u64 ekonHashmapRead8(const u8 *const p) {
+  u64 v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static inline u64 ekonHashmapRead4(const u8 *const p) {
+  u32 v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+u32 ekonHashmapWyHash(const char *const s, const u32 len) {
+  const u8 *p = HASHMAP_PTR_CAST(const u8 *, s);
+  u64 seed = ekonHashmapSecret[0], a, b;
+  // every read stays inside the key: short keys are covered by reads from
+  // both ends, which overlap when the key is not a multiple of their size
+  if (EKON_LIKELY(len <= 16)) {
+    if (EKON_LIKELY(len >= 4)) {
+      const u32 mid = (len >> 3) << 2;
+      a = (ekonHashmapRead4(p) << 32) | ekonHashmapRead4(p + mid);
+      b = (ekonHashmapRead4(p + len - 4) << 32) |
+          ekonHashmapRead4(p + len - 4 - mid);
+    } else if (len > 0) {
+      a = (HASHMAP_CAST(u64, p[0]) << 16) |
+          (HASHMAP_CAST(u64, p[len >> 1]) << 8) | p[len - 1];
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    u32 i = len;
+    for (; i > 16; i -= 16, p += 16)
+      seed = ekonHashmapMum(ekonHashmapRead8(p) ^ ekonHashmapSecret[1],
+                            ekonHashmapRead8(p + 8) ^ seed);
+    // the last 16 bytes, overlapping the loop's when len is not a multiple
+    a = ekonHashmapRead8(p + i - 16);
+    b = ekonHashmapRead8(p + i - 8);
+  }
+  u64 high;
+  const u64 low = ekonMul128(a ^ ekonHashmapSecret[1], b ^ seed, &high);
+  const u64 h = ekonHashmapMum(low ^ ekonHashmapSecret[0] ^ len,
+                               high ^ ekonHashmapSecret[1]);
+  return HASHMAP_CAST(u32, h ^ (h >> 32));
+}
+
+u32 ekonHashmapHash(const char *const keyString, const u32 len) {
+  return ekonHashmapWyHash(keyString, len);
 }
+#endif
 
 /**
  *
  * */
 bool ekonHashmapMatchHelper(const struct hashmap_element_s *const element,
                             const char *const key, const unsigned len) {
-  return (element->keyLen == len) && (memcmp(element->key, key, len) == 0);
+  // interned keys (see ekonKeyTableNew) are the same address
+  return (element->keyLen == len) &&
+         (element->key == key || memcmp(element->key, key, len) == 0);
+}
+
+u32 ekonHashmapGroupMatch(const u8 *const ctrl, const u8 b) {
+#if defined(EKON_SIMD_SSE2) || defined(EKON_SIMD_AVX2)
+  const __m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+  return (u32)_mm_movemask_epi8(
+      _mm_cmpeq_epi8(group, _mm_set1_epi8(HASHMAP_CAST(char, b))));
+#else
+  u32 i, mask = 0;
+  for (i = 0; i < HASHMAP_GROUP_WIDTH; i++)
+    mask |= (u32)(ctrl[i] == b) << i;
+  return mask;
+#endif
+}
+
+u32 ekonHashmapGroupMatchFree(const u8 *const ctrl) {
+#if defined(EKON_SIMD_SSE2) || defined(EKON_SIMD_AVX2)
+  // empty and deleted are the control bytes with the high bit set
+  return (u32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)ctrl));
+#else
+  u32 i, mask = 0;
+  for (i = 0; i < HASHMAP_GROUP_WIDTH; i++)
+    mask |= (u32)(ctrl[i] >> 7) << i;
+  return mask;
+#endif
 }
 
 /**
- * @brief Finds a place to put our hashitem
+ * @brief look a key up. the probe goes from group to group (triangular
+ *        steps, so every group is seen once) and stops at the first group
+ *        with an empty slot
  * @param m         hashmap
- * @param key       takes this key, checks its presence and gives out an index
- * @param len       length of the key in question
- * @param outIndex  returns the index of the free space is stored
- * @return          success/failure
+ * @param key       key to look for
+ * @param len       length of the key
+ * @param hash      ekonHashmapHash of the key
+ * @return          slot of the key, or m->tableSize if it is not there
  * */
-bool ekonHashmapHashHelper(const EkonHashmap *const m, const char *const key,
-                           const u32 keyLen, u32 *const outIndex) {
-  u32 curr;
-  u32 i;
-  // If full, return immediately
-  if (m->size >= m->tableSize) {
-    return true;
-  }
-
-  // Find the best index
-  curr = ekonHashmapHashHelperIntHelper(m, key, keyLen);
-  // Linear probing
-  for (i = 0; i < HASHMAP_MAX_CHAIN_LENGTH; i++) {
-    if (!m->data[curr].inUse) {
-      *outIndex = curr;
-      return false;
-    }
-
-    if (m->data[curr].inUse &&
-        ekonHashmapMatchHelper(&m->data[curr], key, keyLen)) {
-      *outIndex = curr;
-      return false;
+u32 ekonHashmapFind(const EkonHashmap *const m, const char *const key,
+                    const u32 len, const u32 hash) {
+  const u32 groupMask = m->tableSize / HASHMAP_GROUP_WIDTH - 1;
+  u32 group = (hash >> 7) & groupMask;
+  u32 step;
+  for (step = 1; step <= groupMask + 1; step++) {
+    const u8 *const ctrl = m->ctrl + group * HASHMAP_GROUP_WIDTH;
+    u32 match = ekonHashmapGroupMatch(ctrl, HASHMAP_CAST(u8, hash & 0x7F));
+    for (; match != 0; match &= match - 1) {
+      const u32 index = group * HASHMAP_GROUP_WIDTH + ekonCtz64(match);
+      // the whole hash first, the key bytes only when it matches
+      if (m->data[index].hash == hash &&
+          ekonHashmapMatchHelper(&m->data[index], key, len))
+        return index;
     }
+    if (EKON_LIKELY(ekonHashmapGroupMatch(ctrl, HASHMAP_CTRL_EMPTY) != 0))
+      break;
+    group = (group + step) & groupMask;
+  }
+  return m->tableSize;
+}
 
-    curr = (curr + 1) % m->tableSize;
+/**
+ * @brief first empty or deleted slot on the probe sequence of a hash. there
+ *        is always one: at least 1/8 of the slots stay empty
+ * @param m         hashmap
+ * @param hash      ekonHashmapHash of the key to put
+ * @return          the slot
+ * */
+u32 ekonHashmapFindFree(const EkonHashmap *const m, const u32 hash) {
+  const u32 groupMask = m->tableSize / HASHMAP_GROUP_WIDTH - 1;
+  u32 group = (hash >> 7) & groupMask;
+  u32 step;
+  for (step = 1;; step++) {
+    const u32 free =
+        ekonHashmapGroupMatchFree(m->ctrl + group * HASHMAP_GROUP_WIDTH);
+    if (EKON_LIKELY(free != 0))
+      return group * HASHMAP_GROUP_WIDTH + ekonCtz64(free);
+    group = (group + step) & groupMask;
   }
-  return true;
 }
 
-// returns true if success
-i8 ekonHashmapRehashIterator(EkonAllocator *a, void *const newHash,
-                             EkonHashmapItem *const e) {
-  EkonHashmapItem *node =
-      (EkonHashmapItem *)ekonAllocatorAlloc(a, sizeof(EkonHashmapItem *));
-  return ekonHashmapPut(a, HASHMAP_PTR_CAST(EkonHashmap *, newHash), e->key,
-                        e->keyLen, e->value, &node);
+/**
+ * @brief free the slot `index`. probes stop at a group with an empty slot,
+ *        so if the group already has one the slot can be emptied as well.
+ *        otherwise a probe may have to go on past it, and it is marked
+ *        deleted
+ * @param m         hashmap
+ * @param index     a used slot
+ * */
+void ekonHashmapErase(EkonHashmap *const m, const u32 index) {
+  const u8 *const group = m->ctrl + (index & ~(HASHMAP_GROUP_WIDTH - 1));
+  if (ekonHashmapGroupMatch(group, HASHMAP_CTRL_EMPTY) != 0) {
+    m->ctrl[index] = HASHMAP_CTRL_EMPTY;
+    m->growthLeft++;
+  } else {
+    m->ctrl[index] = HASHMAP_CTRL_DELETED;
+  }
+  memset(&m->data[index], 0, sizeof(EkonHashmapItem));
+  m->size--;
 }
 
-/* Doubles the size of the hashmap, and
- * rehashes all the elements */
+/* Moves the keys to a new table: twice as large, or as large when most of
+ * the used up slots are deleted ones. Nodes that point to their slot are
+ * pointed to the new one */
 bool ekonHashmapRehashHelper(EkonAllocator *a, EkonHashmap *const m) {
-  // If this multiplication overflows hashmap_create will fail.
-  u32 newSize = 2 * m->tableSize;
+  const u32 maxKeys = m->tableSize - m->tableSize / 8;
+  const u32 newSize = m->size >= maxKeys / 2 ? 2 * m->tableSize : m->tableSize;
 
   EkonHashmap newHash;
-
-  bool flag = ekonHashmapInit(a, newSize, &newHash);
-  if (flag == false) // failure
+  if (ekonHashmapInit(a, newSize - newSize / 8, &newHash) == false)
     return false;
 
-  // copy the old elements to the new table
-  flag = ekonHashmapIteratePairs(a, m, ekonHashmapRehashIterator,
-                                 HASHMAP_PTR_CAST(void *, &newHash));
-  if (flag == false) // could not complete iteration
-    return flag;
+  u32 group;
+  for (group = 0; group < m->tableSize; group += HASHMAP_GROUP_WIDTH) {
+    u32 full = ~ekonHashmapGroupMatchFree(m->ctrl + group) & 0xFFFF;
+    for (; full != 0; full &= full - 1) {
+      EkonHashmapItem *const e = &m->data[group + ekonCtz64(full)];
+      const u32 index = ekonHashmapFindFree(&newHash, e->hash);
+      newHash.ctrl[index] = HASHMAP_CAST(u8, e->hash & 0x7F);
+      newHash.data[index] = *e;
+      if (e->value != NULL && e->value->hashItem == e)
+        e->value->hashItem = &newHash.data[index];
+    }
+  }
+  newHash.size = m->size;
+  newHash.growthLeft -= m->size;
+  newHash.shadowed = m->shadowed;
 
   // put new hash into old hash structure by copying
   memcpy(m, &newHash, sizeof(EkonHashmap));
@@ -485,10 +674,7 @@ bool ekonHashmapRehashHelper(EkonAllocator *a, EkonHashmap *const m) {
 //  EKON API IMPLEMENTATION
 // ----------------------------------------------------
 
-// Macros and functions wrt memory management
-#ifndef EKON_MEMORY_NODE
-#define EKON_MEMORY_NODE 1
-#endif
+// Macros and functions wrt memory management (see EKON_MEMORY_NODE)
 #if EKON_MEMORY_NODE == 1
 // @return an allocated string
 void *ekonNew(u32 size) { return malloc(size); }
@@ -502,7 +688,14 @@ static u32 ekonAllocMemorySize = 0, ekonAllocMemoryCount = 0,
 void *ekonNew(u32 size) {
   return ekonAllocMemorySize += size, ekonAllocMemoryCount += 1, malloc(size);
 }
-void ekonFree(void *ptr) { freeMemoryCount += 1, free(ptr); }
+void ekonFree(void *ptr) { ekonFreeMemoryCount += 1, free(ptr); }
+
+void ekonMemoryStats(u32 *outAllocCount, u32 *outAllocSize,
+                     u32 *outFreeCount) {
+  *outAllocCount = ekonAllocMemoryCount;
+  *outAllocSize = ekonAllocMemorySize;
+  *outFreeCount = ekonFreeMemoryCount;
+}
 #endif
 
 // store constants in char arrays
@@ -514,42 +707,75 @@ static const char *ekonStrNull = "null";
 bool ekonCheckNum(const char *s, u32 *outLen);
 // ---------------------------------
 
+// token that a value starting with a character belongs to. the low bits of
+// ekonCharClass
+typedef enum {
+  EKON_TOKEN_OTHER = 0,   // unquoted string or a stray character
+  EKON_TOKEN_ARRAY = 1,   // [
+  EKON_TOKEN_OBJECT = 2,  // {
+  EKON_TOKEN_KEYWORD = 3, // n f t
+  EKON_TOKEN_STRING = 4,  // ' "
+  EKON_TOKEN_NUMBER = 5   // - + . 0-9
+} EkonToken;
+
+// character class flags in ekonCharClass
+#define EKON_CHAR_TOKEN 0x07   // EkonToken mask
+#define EKON_CHAR_WHITE 0x08   // ' ' '\t' '\n' '\r'
+#define EKON_CHAR_END 0x10     // ends an unquoted string
+#define EKON_CHAR_CONTROL 0x20 // <= 0x1f
+#define EKON_CHAR_QUOTE 0x40   // ' "
+#define EKON_CHAR_BRACKET 0x80 // [ ] { }
+
+// class of every byte. EkonToken | EKON_CHAR_*
+static const u8 ekonCharClass[256] = {
+    0x30, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0x00
+    0x20, 0x38, 0x38, 0x20, 0x20, 0x38, 0x20, 0x20, // 0x08
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0x10
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0x18
+    0x18, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x54, // 0x20
+    0x00, 0x00, 0x00, 0x05, 0x10, 0x05, 0x05, 0x00, // 0x28
+    0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, // 0x30
+    0x05, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x38
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x40
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x48
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x50
+    0x00, 0x00, 0x00, 0x91, 0x00, 0x90, 0x00, 0x00, // 0x58
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, // 0x60
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, // 0x68
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, // 0x70
+    0x00, 0x00, 0x00, 0x92, 0x00, 0x90, 0x00, 0x00, // 0x78
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x80
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x88
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x90
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x98
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xB0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xB8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xE0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xE8
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF0
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF8
+};
+
+// class of a character
+#define ekonClass(c) (ekonCharClass[(unsigned char)(c)])
+
 // check if character is quote
-bool ekonIsQuote(const char c) { return c == '\'' || c == '"'; }
+bool ekonIsQuote(const char c) { return (ekonClass(c) & EKON_CHAR_QUOTE) != 0; }
 
 // check if character is a bracket
 bool ekonIsBracket(const char c) {
-  switch (c) {
-  case '{':
-  case '}':
-  case ']':
-  case '[':
-    return true;
-  default:
-    return false;
-  }
+  return (ekonClass(c) & EKON_CHAR_BRACKET) != 0;
 }
 
 // @brief check if character is among: <space> \t \n \r [ ] { } ' " , : \0
 bool ekonIsNonUnquotedStrChar(const char c) {
-  switch (c) {
-  case ' ':
-  case '\t':
-  case '\n':
-  case '\r':
-  case '[':
-  case ']':
-  case '{':
-  case '}':
-  case '"':
-  case '\'':
-  case '\0':
-  case ',':
-  case ':':
-    return true;
-  default:
-    return false;
-  };
+  return (ekonClass(c) & EKON_CHAR_END) != 0;
 }
 
 /**
@@ -570,7 +796,7 @@ void ekonCopy(const char *src, const u32 len, char *des) {
  * @return des      destination string (appened with '\0')
  * */
 char *ekonCopySchema(const char *src, const u32 len) {
-  char *schema = (char *)malloc(sizeof(char) * (len + 1));
+  char *schema = (char *)ekonNew(sizeof(char) * (len + 1));
   memcpy(schema, src, len);
   schema[len] = '\0';
   return schema;
@@ -579,6 +805,19 @@ char *ekonCopySchema(const char *src, const u32 len) {
 // length of string
 u32 ekonStrLen(const char *str) { return (u32)strlen(str); }
 
+// `len` of a source that is only bounded by its terminating '\0'
+#define EKON_NUL_TERMINATED 0xFFFFFFFFU
+
+// s[index], or '\0' at and past the end of a source of `len` bytes
+char ekonCharAt(const char *s, const u32 len, const u32 index) {
+  return EKON_LIKELY(index < len) ? s[index] : 0;
+}
+
+// the bits of an option that describe the key of a node, the only ones a
+// key setter may replace
+#define EKON_KEY_OPTIONS                                                       \
+  (EKON_IS_KEY_SPACED | EKON_IS_KEY_MULTILINED | EKON_IS_KEY_ESCAPABLE)
+
 // convert option from
 EkonOption ekonValueOptionStrToKey(EkonOption option) {
   if ((option & EKON_IS_STR_SPACED) != 0) {
@@ -587,7 +826,7 @@ EkonOption ekonValueOptionStrToKey(EkonOption option) {
   }
   if ((option & EKON_IS_STR_MULTILINED) != 0) {
     option &= (~EKON_IS_STR_MULTILINED);
-    option |= EKON_IS_STR_MULTILINED;
+    option |= EKON_IS_KEY_MULTILINED;
   }
   if ((option & EKON_IS_STR_ESCAPABLE) != 0) {
     option &= (~EKON_IS_STR_ESCAPABLE);
@@ -596,182 +835,2094 @@ EkonOption ekonValueOptionStrToKey(EkonOption option) {
   return option;
 }
 
-// math.pow
-float power(float b, int e) {
-  float final = b;
-  int e2 = e;
-  if (e < 0)
-    e2 = -e;
-  for (int i = 0; i < e2; i++)
-    final *= b;
-  return e2 < 0 ? 1 / final : final;
+// 128-bit approximations of 5^q for q in [EKON_POW5_MIN, EKON_POW5_MAX],
+// normalized so that the high word has its top bit set. high word first.
+// negative powers are rounded up, as in fast_float's table
+#define EKON_POW5_MIN (-342)
+#define EKON_POW5_MAX 308
+static const u64 ekonPow5[2 * (EKON_POW5_MAX - EKON_POW5_MIN + 1)] = {
+    0xeef453d6923bd65a, 0x113faa2906a13b3f,
+    0x9558b4661b6565f8, 0x4ac7ca59a424c507,
+    0xbaaee17fa23ebf76, 0x5d79bcf00d2df649,
+    0xe95a99df8ace6f53, 0xf4d82c2c107973dc,
+    0x91d8a02bb6c10594, 0x79071b9b8a4be869,
+    0xb64ec836a47146f9, 0x9748e2826cdee284,
+    0xe3e27a444d8d98b7, 0xfd1b1b2308169b25,
+    0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7,
+    0xb208ef855c969f4f, 0xbdbd2d335e51a935,
+    0xde8b2b66b3bc4723, 0xad2c788035e61382,
+    0x8b16fb203055ac76, 0x4c3bcb5021afcc31,
+    0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d,
+    0xd953e8624b85dd78, 0xd71d6dad34a2af0d,
+    0x87d4713d6f33aa6b, 0x8672648c40e5ad68,
+    0xa9c98d8ccb009506, 0x680efdaf511f18c2,
+    0xd43bf0effdc0ba48, 0x0212bd1b2566def2,
+    0x84a57695fe98746d, 0x014bb630f7604b57,
+    0xa5ced43b7e3e9188, 0x419ea3bd35385e2d,
+    0xcf42894a5dce35ea, 0x52064cac828675b9,
+    0x818995ce7aa0e1b2, 0x7343efebd1940993,
+    0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8,
+    0xca66fa129f9b60a6, 0xd41a26e077774ef6,
+    0xfd00b897478238d0, 0x8920b098955522b4,
+    0x9e20735e8cb16382, 0x55b46e5f5d5535b0,
+    0xc5a890362fddbc62, 0xeb2189f734aa831d,
+    0xf712b443bbd52b7b, 0xa5e9ec7501d523e4,
+    0x9a6bb0aa55653b2d, 0x47b233c92125366e,
+    0xc1069cd4eabe89f8, 0x999ec0bb696e840a,
+    0xf148440a256e2c76, 0xc00670ea43ca250d,
+    0x96cd2a865764dbca, 0x380406926a5e5728,
+    0xbc807527ed3e12bc, 0xc605083704f5ecf2,
+    0xeba09271e88d976b, 0xf7864a44c633682e,
+    0x93445b8731587ea3, 0x7ab3ee6afbe0211d,
+    0xb8157268fdae9e4c, 0x5960ea05bad82964,
+    0xe61acf033d1a45df, 0x6fb92487298e33bd,
+    0x8fd0c16206306bab, 0xa5d3b6d479f8e056,
+    0xb3c4f1ba87bc8696, 0x8f48a4899877186c,
+    0xe0b62e2929aba83c, 0x331acdabfe94de87,
+    0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14,
+    0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9,
+    0xdb71e91432b1a24a, 0xc9e82cd9f69d6150,
+    0x892731ac9faf056e, 0xbe311c083a225cd2,
+    0xab70fe17c79ac6ca, 0x6dbd630a48aaf406,
+    0xd64d3d9db981787d, 0x092cbbccdad5b108,
+    0x85f0468293f0eb4e, 0x25bbf56008c58ea5,
+    0xa76c582338ed2621, 0xaf2af2b80af6f24e,
+    0xd1476e2c07286faa, 0x1af5af660db4aee1,
+    0x82cca4db847945ca, 0x50d98d9fc890ed4d,
+    0xa37fce126597973c, 0xe50ff107bab528a0,
+    0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8,
+    0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a,
+    0x9faacf3df73609b1, 0x77b191618c54e9ac,
+    0xc795830d75038c1d, 0xd59df5b9ef6a2417,
+    0xf97ae3d0d2446f25, 0x4b0573286b44ad1d,
+    0x9becce62836ac577, 0x4ee367f9430aec32,
+    0xc2e801fb244576d5, 0x229c41f793cda73f,
+    0xf3a20279ed56d48a, 0x6b43527578c1110f,
+    0x9845418c345644d6, 0x830a13896b78aaa9,
+    0xbe5691ef416bd60c, 0x23cc986bc656d553,
+    0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8,
+    0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9,
+    0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53,
+    0xe858ad248f5c22c9, 0xd1b3400f8f9cff68,
+    0x91376c36d99995be, 0x23100809b9c21fa1,
+    0xb58547448ffffb2d, 0xabd40a0c2832a78a,
+    0xe2e69915b3fff9f9, 0x16c90c8f323f516c,
+    0x8dd01fad907ffc3b, 0xae3da7d97f6792e3,
+    0xb1442798f49ffb4a, 0x99cd11cfdf41779c,
+    0xdd95317f31c7fa1d, 0x40405643d711d583,
+    0x8a7d3eef7f1cfc52, 0x482835ea666b2572,
+    0xad1c8eab5ee43b66, 0xda3243650005eecf,
+    0xd863b256369d4a40, 0x90bed43e40076a82,
+    0x873e4f75e2224e68, 0x5a7744a6e804a291,
+    0xa90de3535aaae202, 0x711515d0a205cb36,
+    0xd3515c2831559a83, 0x0d5a5b44ca873e03,
+    0x8412d9991ed58091, 0xe858790afe9486c2,
+    0xa5178fff668ae0b6, 0x626e974dbe39a872,
+    0xce5d73ff402d98e3, 0xfb0a3d212dc8128f,
+    0x80fa687f881c7f8e, 0x7ce66634bc9d0b99,
+    0xa139029f6a239f72, 0x1c1fffc1ebc44e80,
+    0xc987434744ac874e, 0xa327ffb266b56220,
+    0xfbe9141915d7a922, 0x4bf1ff9f0062baa8,
+    0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9,
+    0xc4ce17b399107c22, 0xcb550fb4384d21d3,
+    0xf6019da07f549b2b, 0x7e2a53a146606a48,
+    0x99c102844f94e0fb, 0x2eda7444cbfc426d,
+    0xc0314325637a1939, 0xfa911155fefb5308,
+    0xf03d93eebc589f88, 0x793555ab7eba27ca,
+    0x96267c7535b763b5, 0x4bc1558b2f3458de,
+    0xbbb01b9283253ca2, 0x9eb1aaedfb016f16,
+    0xea9c227723ee8bcb, 0x465e15a979c1cadc,
+    0x92a1958a7675175f, 0x0bfacd89ec191ec9,
+    0xb749faed14125d36, 0xcef980ec671f667b,
+    0xe51c79a85916f484, 0x82b7e12780e7401a,
+    0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810,
+    0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15,
+    0xdfbdcece67006ac9, 0x67a791e093e1d49a,
+    0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0,
+    0xaecc49914078536d, 0x58fae9f773886e18,
+    0xda7f5bf590966848, 0xaf39a475506a899e,
+    0x888f99797a5e012d, 0x6d8406c952429603,
+    0xaab37fd7d8f58178, 0xc8e5087ba6d33b83,
+    0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64,
+    0x855c3be0a17fcd26, 0x5cf2eea09a55067f,
+    0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e,
+    0xd0601d8efc57b08b, 0xf13b94daf124da26,
+    0x823c12795db6ce57, 0x76c53d08d6b70858,
+    0xa2cb1717b52481ed, 0x54768c4b0c64ca6e,
+    0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09,
+    0xfe5d54150b090b02, 0xd3f93b35435d7c4c,
+    0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf,
+    0xc6b8e9b0709f109a, 0x359ab6419ca1091b,
+    0xf867241c8cc6d4c0, 0xc30163d203c94b62,
+    0x9b407691d7fc44f8, 0x79e0de63425dcf1d,
+    0xc21094364dfb5636, 0x985915fc12f542e4,
+    0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d,
+    0x979cf3ca6cec5b5a, 0xa705992ceecf9c42,
+    0xbd8430bd08277231, 0x50c6ff782a838353,
+    0xece53cec4a314ebd, 0xa4f8bf5635246428,
+    0x940f4613ae5ed136, 0x871b7795e136be99,
+    0xb913179899f68584, 0x28e2557b59846e3f,
+    0xe757dd7ec07426e5, 0x331aeada2fe589cf,
+    0x9096ea6f3848984f, 0x3ff0d2c85def7621,
+    0xb4bca50b065abe63, 0x0fed077a756b53a9,
+    0xe1ebce4dc7f16dfb, 0xd3e8495912c62894,
+    0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c,
+    0xb080392cc4349dec, 0xbd8d794d96aacfb3,
+    0xdca04777f541c567, 0xecf0d7a0fc5583a0,
+    0x89e42caaf9491b60, 0xf41686c49db57244,
+    0xac5d37d5b79b6239, 0x311c2875c522ced5,
+    0xd77485cb25823ac7, 0x7d633293366b828b,
+    0x86a8d39ef77164bc, 0xae5dff9c02033197,
+    0xa8530886b54dbdeb, 0xd9f57f830283fdfc,
+    0xd267caa862a12d66, 0xd072df63c324fd7b,
+    0x8380dea93da4bc60, 0x4247cb9e59f71e6d,
+    0xa46116538d0deb78, 0x52d9be85f074e608,
+    0xcd795be870516656, 0x67902e276c921f8b,
+    0x806bd9714632dff6, 0x00ba1cd8a3db53b6,
+    0xa086cfcd97bf97f3, 0x80e8a40eccd228a4,
+    0xc8a883c0fdaf7df0, 0x6122cd128006b2cd,
+    0xfad2a4b13d1b5d6c, 0x796b805720085f81,
+    0x9cc3a6eec6311a63, 0xcbe3303674053bb0,
+    0xc3f490aa77bd60fc, 0xbedbfc4411068a9c,
+    0xf4f1b4d515acb93b, 0xee92fb5515482d44,
+    0x991711052d8bf3c5, 0x751bdd152d4d1c4a,
+    0xbf5cd54678eef0b6, 0xd262d45a78a0635d,
+    0xef340a98172aace4, 0x86fb897116c87c34,
+    0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0,
+    0xbae0a846d2195712, 0x8974836059cca109,
+    0xe998d258869facd7, 0x2bd1a438703fc94b,
+    0x91ff83775423cc06, 0x7b6306a34627ddcf,
+    0xb67f6455292cbf08, 0x1a3bc84c17b1d542,
+    0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93,
+    0x8e938662882af53e, 0x547eb47b7282ee9c,
+    0xb23867fb2a35b28d, 0xe99e619a4f23aa43,
+    0xdec681f9f4c31f31, 0x6405fa00e2ec94d4,
+    0x8b3c113c38f9f37e, 0xde83bc408dd3dd04,
+    0xae0b158b4738705e, 0x9624ab50b148d445,
+    0xd98ddaee19068c76, 0x3badd624dd9b0957,
+    0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6,
+    0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c,
+    0xd47487cc8470652b, 0x7647c3200069671f,
+    0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073,
+    0xa5fb0a17c777cf09, 0xf468107100525890,
+    0xcf79cc9db955c2cc, 0x7182148d4066eeb4,
+    0x81ac1fe293d599bf, 0xc6f14cd848405530,
+    0xa21727db38cb002f, 0xb8ada00e5a506a7c,
+    0xca9cf1d206fdc03b, 0xa6d90811f0e4851c,
+    0xfd442e4688bd304a, 0x908f4a166d1da663,
+    0x9e4a9cec15763e2e, 0x9a598e4e043287fe,
+    0xc5dd44271ad3cdba, 0x40eff1e1853f29fd,
+    0xf7549530e188c128, 0xd12bee59e68ef47c,
+    0x9a94dd3e8cf578b9, 0x82bb74f8301958ce,
+    0xc13a148e3032d6e7, 0xe36a52363c1faf01,
+    0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1,
+    0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9,
+    0xbcb2b812db11a5de, 0x7415d448f6b6f0e7,
+    0xebdf661791d60f56, 0x111b495b3464ad21,
+    0x936b9fcebb25c995, 0xcab10dd900beec34,
+    0xb84687c269ef3bfb, 0x3d5d514f40eea742,
+    0xe65829b3046b0afa, 0x0cb4a5a3112a5112,
+    0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab,
+    0xb3f4e093db73a093, 0x59ed216765690f56,
+    0xe0f218b8d25088b8, 0x306869c13ec3532c,
+    0x8c974f7383725573, 0x1e414218c73a13fb,
+    0xafbd2350644eeacf, 0xe5d1929ef90898fa,
+    0xdbac6c247d62a583, 0xdf45f746b74abf39,
+    0x894bc396ce5da772, 0x6b8bba8c328eb783,
+    0xab9eb47c81f5114f, 0x066ea92f3f326564,
+    0xd686619ba27255a2, 0xc80a537b0efefebd,
+    0x8613fd0145877585, 0xbd06742ce95f5f36,
+    0xa798fc4196e952e7, 0x2c48113823b73704,
+    0xd17f3b51fca3a7a0, 0xf75a15862ca504c5,
+    0x82ef85133de648c4, 0x9a984d73dbe722fb,
+    0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba,
+    0xcc963fee10b7d1b3, 0x318df905079926a8,
+    0xffbbcfe994e5c61f, 0xfdf17746497f7052,
+    0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633,
+    0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0,
+    0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0,
+    0x9c1661a651213e2d, 0x06bea10ca65c084e,
+    0xc31bfa0fe5698db8, 0x486e494fcff30a62,
+    0xf3e2f893dec3f126, 0x5a89dba3c3efccfa,
+    0x986ddb5c6b3a76b7, 0xf89629465a75e01c,
+    0xbe89523386091465, 0xf6bbb397f1135823,
+    0xee2ba6c0678b597f, 0x746aa07ded582e2c,
+    0x94db483840b717ef, 0xa8c2a44eb4571cdc,
+    0xba121a4650e4ddeb, 0x92f34d62616ce413,
+    0xe896a0d7e51e1566, 0x77b020baf9c81d17,
+    0x915e2486ef32cd60, 0x0ace1474dc1d122e,
+    0xb5b5ada8aaff80b8, 0x0d819992132456ba,
+    0xe3231912d5bf60e6, 0x10e1fff697ed6c69,
+    0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1,
+    0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2,
+    0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde,
+    0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b,
+    0xad4ab7112eb3929d, 0x86c16c98d2c953c6,
+    0xd89d64d57a607744, 0xe871c7bf077ba8b7,
+    0x87625f056c7c4a8b, 0x11471cd764ad4972,
+    0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf,
+    0xd389b47879823479, 0x4aff1d108d4ec2c3,
+    0x843610cb4bf160cb, 0xcedf722a585139ba,
+    0xa54394fe1eedb8fe, 0xc2974eb4ee658828,
+    0xce947a3da6a9273e, 0x733d226229feea32,
+    0x811ccc668829b887, 0x0806357d5a3f525f,
+    0xa163ff802a3426a8, 0xca07c2dcb0cf26f7,
+    0xc9bcff6034c13052, 0xfc89b393dd02f0b5,
+    0xfc2c3f3841f17c67, 0xbbac2078d443ace2,
+    0x9d9ba7832936edc0, 0xd54b944b84aa4c0d,
+    0xc5029163f384a931, 0x0a9e795e65d4df11,
+    0xf64335bcf065d37d, 0x4d4617b5ff4a16d5,
+    0x99ea0196163fa42e, 0x504bced1bf8e4e45,
+    0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6,
+    0xf07da27a82c37088, 0x5d767327bb4e5a4c,
+    0x964e858c91ba2655, 0x3a6a07f8d510f86f,
+    0xbbe226efb628afea, 0x890489f70a55368b,
+    0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e,
+    0x92c8ae6b464fc96f, 0x3b0b8bc90012929d,
+    0xb77ada0617e3bbcb, 0x09ce6ebb40173744,
+    0xe55990879ddcaabd, 0xcc420a6a101d0515,
+    0x8f57fa54c2a9eab6, 0x9fa946824a12232d,
+    0xb32df8e9f3546564, 0x47939822dc96abf9,
+    0xdff9772470297ebd, 0x59787e2b93bc56f7,
+    0x8bfbea76c619ef36, 0x57eb4edb3c55b65a,
+    0xaefae51477a06b03, 0xede622920b6b23f1,
+    0xdab99e59958885c4, 0xe95fab368e45eced,
+    0x88b402f7fd75539b, 0x11dbcb0218ebb414,
+    0xaae103b5fcd2a881, 0xd652bdc29f26a119,
+    0xd59944a37c0752a2, 0x4be76d3346f0495f,
+    0x857fcae62d8493a5, 0x6f70a4400c562ddb,
+    0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952,
+    0xd097ad07a71f26b2, 0x7e2000a41346a7a7,
+    0x825ecc24c873782f, 0x8ed400668c0c28c8,
+    0xa2f67f2dfa90563b, 0x728900802f0f32fa,
+    0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9,
+    0xfea126b7d78186bc, 0xe2f610c84987bfa8,
+    0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9,
+    0xc6ede63fa05d3143, 0x91503d1c79720dbb,
+    0xf8a95fcf88747d94, 0x75a44c6397ce912a,
+    0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba,
+    0xc24452da229b021b, 0xfbe85badce996168,
+    0xf2d56790ab41c2a2, 0xfae27299423fb9c3,
+    0x97c560ba6b0919a5, 0xdccd879fc967d41a,
+    0xbdb6b8e905cb600f, 0x5400e987bbc1c920,
+    0xed246723473e3813, 0x290123e9aab23b68,
+    0x9436c0760c86e30b, 0xf9a0b6720aaf6521,
+    0xb94470938fa89bce, 0xf808e40e8d5b3e69,
+    0xe7958cb87392c2c2, 0xb60b1d1230b20e04,
+    0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2,
+    0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3,
+    0xe2280b6c20dd5232, 0x25c6da63c38de1b0,
+    0x8d590723948a535f, 0x579c487e5a38ad0e,
+    0xb0af48ec79ace837, 0x2d835a9df0c6d851,
+    0xdcdb1b2798182244, 0xf8e431456cf88e65,
+    0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff,
+    0xac8b2d36eed2dac5, 0xe272467e3d222f3f,
+    0xd7adf884aa879177, 0x5b0ed81dcc6abb0f,
+    0x86ccbb52ea94baea, 0x98e947129fc2b4e9,
+    0xa87fea27a539e9a5, 0x3f2398d747b36224,
+    0xd29fe4b18e88640e, 0x8eec7f0d19a03aad,
+    0x83a3eeeef9153e89, 0x1953cf68300424ac,
+    0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7,
+    0xcdb02555653131b6, 0x3792f412cb06794d,
+    0x808e17555f3ebf11, 0xe2bbd88bbee40bd0,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4,
+    0xc8de047564d20a8b, 0xf245825a5a445275,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56712,
+    0x9ced737bb6c4183d, 0x55464dd69685606b,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b886,
+    0xf53304714d9265df, 0xd53dd99f4b3066a8,
+    0x993fe2c6d07b7fab, 0xe546a8038efe4029,
+    0xbf8fdb78849a5f96, 0xde98520472bdd033,
+    0xef73d256a5c0f77c, 0x963e66858f6d4440,
+    0x95a8637627989aad, 0xdde7001379a44aa8,
+    0xbb127c53b17ec159, 0x5560c018580d5d52,
+    0xe9d71b689dde71af, 0xaab8f01e6e10b4a6,
+    0x9226712162ab070d, 0xcab3961304ca70e8,
+    0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506a,
+    0x8eb98a7a9a5b04e3, 0x77f3608e92adb242,
+    0xb267ed1940f1c61c, 0x55f038b237591ed3,
+    0xdf01e85f912e37a3, 0x6b6c46dec52f6688,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da015,
+    0xae397d8aa96c1b77, 0xabec975e0a0d081a,
+    0xd9c7dced53c72255, 0x96e7bd358c904a21,
+    0x881cea14545c7575, 0x7e50d64177da2e54,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9e9,
+    0xd4ad2dbfc3d07787, 0x955e4ec64b44e864,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113e,
+    0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e,
+    0xcfb11ead453994ba, 0x67de18eda5814af2,
+    0x81ceb32c4b43fcf4, 0x80eacf948770ced7,
+    0xa2425ff75e14fc31, 0xa1258379a94d028d,
+    0xcad2f7f5359a3b3e, 0x096ee45813a04330,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fc,
+    0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e,
+    0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543,
+    0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339,
+    0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585,
+    0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0,
+    0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4,
+    0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95,
+    0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4,
+    0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c,
+    0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e,
+    0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110,
+    0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9,
+    0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4,
+    0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000000,
+    0xa000000000000000, 0x0000000000000000,
+    0xc800000000000000, 0x0000000000000000,
+    0xfa00000000000000, 0x0000000000000000,
+    0x9c40000000000000, 0x0000000000000000,
+    0xc350000000000000, 0x0000000000000000,
+    0xf424000000000000, 0x0000000000000000,
+    0x9896800000000000, 0x0000000000000000,
+    0xbebc200000000000, 0x0000000000000000,
+    0xee6b280000000000, 0x0000000000000000,
+    0x9502f90000000000, 0x0000000000000000,
+    0xba43b74000000000, 0x0000000000000000,
+    0xe8d4a51000000000, 0x0000000000000000,
+    0x9184e72a00000000, 0x0000000000000000,
+    0xb5e620f480000000, 0x0000000000000000,
+    0xe35fa931a0000000, 0x0000000000000000,
+    0x8e1bc9bf04000000, 0x0000000000000000,
+    0xb1a2bc2ec5000000, 0x0000000000000000,
+    0xde0b6b3a76400000, 0x0000000000000000,
+    0x8ac7230489e80000, 0x0000000000000000,
+    0xad78ebc5ac620000, 0x0000000000000000,
+    0xd8d726b7177a8000, 0x0000000000000000,
+    0x878678326eac9000, 0x0000000000000000,
+    0xa968163f0a57b400, 0x0000000000000000,
+    0xd3c21bcecceda100, 0x0000000000000000,
+    0x84595161401484a0, 0x0000000000000000,
+    0xa56fa5b99019a5c8, 0x0000000000000000,
+    0xcecb8f27f4200f3a, 0x0000000000000000,
+    0x813f3978f8940984, 0x4000000000000000,
+    0xa18f07d736b90be5, 0x5000000000000000,
+    0xc9f2c9cd04674ede, 0xa400000000000000,
+    0xfc6f7c4045812296, 0x4d00000000000000,
+    0x9dc5ada82b70b59d, 0xf020000000000000,
+    0xc5371912364ce305, 0x6c28000000000000,
+    0xf684df56c3e01bc6, 0xc732000000000000,
+    0x9a130b963a6c115c, 0x3c7f400000000000,
+    0xc097ce7bc90715b3, 0x4b9f100000000000,
+    0xf0bdc21abb48db20, 0x1e86d40000000000,
+    0x96769950b50d88f4, 0x1314448000000000,
+    0xbc143fa4e250eb31, 0x17d955a000000000,
+    0xeb194f8e1ae525fd, 0x5dcfab0800000000,
+    0x92efd1b8d0cf37be, 0x5aa1cae500000000,
+    0xb7abc627050305ad, 0xf14a3d9e40000000,
+    0xe596b7b0c643c719, 0x6d9ccd05d0000000,
+    0x8f7e32ce7bea5c6f, 0xe4820023a2000000,
+    0xb35dbf821ae4f38b, 0xdda2802c8a800000,
+    0xe0352f62a19e306e, 0xd50b2037ad200000,
+    0x8c213d9da502de45, 0x4526f422cc340000,
+    0xaf298d050e4395d6, 0x9670b12b7f410000,
+    0xdaf3f04651d47b4c, 0x3c0cdd765f114000,
+    0x88d8762bf324cd0f, 0xa5880a69fb6ac800,
+    0xab0e93b6efee0053, 0x8eea0d047a457a00,
+    0xd5d238a4abe98068, 0x72a4904598d6d880,
+    0x85a36366eb71f041, 0x47a6da2b7f864750,
+    0xa70c3c40a64e6c51, 0x999090b65f67d924,
+    0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d,
+    0x82818f1281ed449f, 0xbff8f10e7a8921a4,
+    0xa321f2d7226895c7, 0xaff72d52192b6a0d,
+    0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490,
+    0xfee50b7025c36a08, 0x02f236d04753d5b4,
+    0x9f4f2726179a2245, 0x01d762422c946590,
+    0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5,
+    0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2,
+    0x9b934c3b330c8577, 0x63cc55f49f88eb2f,
+    0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb,
+    0xf316271c7fc3908a, 0x8bef464e3945ef7a,
+    0x97edd871cfda3a56, 0x97758bf0e3cbb5ac,
+    0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317,
+    0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd,
+    0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a,
+    0xb975d6b6ee39e436, 0xb3e2fd538e122b44,
+    0xe7d34c64a9c85d44, 0x60dbbca87196b616,
+    0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd,
+    0xb51d13aea4a488dd, 0x6babab6398bdbe41,
+    0xe264589a4dcdab14, 0xc696963c7eed2dd1,
+    0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2,
+    0xb0de65388cc8ada8, 0x3b25a55f43294bcb,
+    0xdd15fe86affad912, 0x49ef0eb713f39ebe,
+    0x8a2dbf142dfcc7ab, 0x6e3569326c784337,
+    0xacb92ed9397bf996, 0x49c2c37f07965404,
+    0xd7e77a8f87daf7fb, 0xdc33745ec97be906,
+    0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3,
+    0xa8acd7c0222311bc, 0xc40832ea0d68ce0c,
+    0xd2d80db02aabd62b, 0xf50a3fa490c30190,
+    0x83c7088e1aab65db, 0x792667c6da79e0fa,
+    0xa4b8cab1a1563f52, 0x577001b891185938,
+    0xcde6fd5e09abcf26, 0xed4c0226b55e6f86,
+    0x80b05e5ac60b6178, 0x544f8158315b05b4,
+    0xa0dc75f1778e39d6, 0x696361ae3db1c721,
+    0xc913936dd571c84c, 0x03bc3a19cd1e38e9,
+    0xfb5878494ace3a5f, 0x04ab48a04065c723,
+    0x9d174b2dcec0e47b, 0x62eb0d64283f9c76,
+    0xc45d1df942711d9a, 0x3ba5d0bd324f8394,
+    0xf5746577930d6500, 0xca8f44ec7ee36479,
+    0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb,
+    0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e,
+    0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e,
+    0x95d04aee3b80ece5, 0xbba1f1d158724a12,
+    0xbb445da9ca61281f, 0x2a8a6e45ae8edc97,
+    0xea1575143cf97226, 0xf52d09d71a3293bd,
+    0x924d692ca61be758, 0x593c2626705f9c56,
+    0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c,
+    0xe498f455c38b997a, 0x0b6dfb9c0f956447,
+    0x8edf98b59a373fec, 0x4724bd4189bd5eac,
+    0xb2977ee300c50fe7, 0x58edec91ec2cb657,
+    0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed,
+    0x8b865b215899f46c, 0xbd79e0d20082ee74,
+    0xae67f1e9aec07187, 0xecd8590680a3aa11,
+    0xda01ee641a708de9, 0xe80e6f4820cc9495,
+    0x884134fe908658b2, 0x3109058d147fdcdd,
+    0xaa51823e34a7eede, 0xbd4b46f0599fd415,
+    0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a,
+    0x850fadc09923329e, 0x03e2cf6bc604ddb0,
+    0xa6539930bf6bff45, 0x84db8346b786151c,
+    0xcfe87f7cef46ff16, 0xe612641865679a63,
+    0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e,
+    0xa26da3999aef7749, 0xe3be5e330f38f09d,
+    0xcb090c8001ab551c, 0x5cadf5bfd3072cc5,
+    0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6,
+    0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa,
+    0xc646d63501a1511d, 0xb281e1fd541501b8,
+    0xf7d88bc24209a565, 0x1f225a7ca91a4226,
+    0x9ae757596946075f, 0x3375788de9b06958,
+    0xc1a12d2fc3978937, 0x0052d6b1641c83ae,
+    0xf209787bb47d6b84, 0xc0678c5dbd23a49a,
+    0x9745eb4d50ce6332, 0xf840b7ba963646e0,
+    0xbd176620a501fbff, 0xb650e5a93bc3d898,
+    0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe,
+    0x93ba47c980e98cdf, 0xc66f336c36b10137,
+    0xb8a8d9bbe123f017, 0xb80b0047445d4184,
+    0xe6d3102ad96cec1d, 0xa60dc059157491e5,
+    0x9043ea1ac7e41392, 0x87c89837ad68db2f,
+    0xb454e4a179dd1877, 0x29babe4598c311fb,
+    0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a,
+    0x8ce2529e2734bb1d, 0x1899e4a65f58660c,
+    0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f,
+    0xdc21a1171d42645d, 0x76707543f4fa1f73,
+    0x899504ae72497eba, 0x6a06494a791c53a8,
+    0xabfa45da0edbde69, 0x0487db9d17636892,
+    0xd6f8d7509292d603, 0x45a9d2845d3c42b6,
+    0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2,
+    0xa7f26836f282b732, 0x8e6cac7768d7141e,
+    0xd1ef0244af2364ff, 0x3207d795430cd926,
+    0x8335616aed761f1f, 0x7f44e6bd49e807b8,
+    0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6,
+    0xcd036837130890a1, 0x36dba887c37a8c0f,
+    0x802221226be55a64, 0xc2494954da2c9789,
+    0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c,
+    0xc83553c5c8965d3d, 0x6f92829494e5acc7,
+    0xfa42a8b73abbf48c, 0xcb772339ba1f17f9,
+    0x9c69a97284b578d7, 0xff2a760414536efb,
+    0xc38413cf25e2d70d, 0xfef5138519684aba,
+    0xf46518c2ef5b8cd1, 0x7eb258665fc25d69,
+    0x98bf2f79d5993802, 0xef2f773ffbd97a61,
+    0xbeeefb584aff8603, 0xaafb550ffacfd8fa,
+    0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38,
+    0x952ab45cfa97a0b2, 0xdd945a747bf26183,
+    0xba756174393d88df, 0x94f971119aeef9e4,
+    0xe912b9d1478ceb17, 0x7a37cd5601aab85d,
+    0x91abb422ccb812ee, 0xac62e055c10ab33a,
+    0xb616a12b7fe617aa, 0x577b986b314d6009,
+    0xe39c49765fdf9d94, 0xed5a7e85fda0b80b,
+    0x8e41ade9fbebc27d, 0x14588f13be847307,
+    0xb1d219647ae6b31c, 0x596eb2d8ae258fc8,
+    0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb,
+    0x8aec23d680043bee, 0x25de7bb9480d5854,
+    0xada72ccc20054ae9, 0xaf561aa79a10ae6a,
+    0xd910f7ff28069da4, 0x1b2ba1518094da04,
+    0x87aa9aff79042286, 0x90fb44d2f05d0842,
+    0xa99541bf57452b28, 0x353a1607ac744a53,
+    0xd3fa922f2d1675f2, 0x42889b8997915ce8,
+    0x847c9b5d7c2e09b7, 0x69956135febada11,
+    0xa59bc234db398c25, 0x43fab9837e699095,
+    0xcf02b2c21207ef2e, 0x94f967e45e03f4bb,
+    0x8161afb94b44f57d, 0x1d1be0eebac278f5,
+    0xa1ba1ba79e1632dc, 0x6462d92a69731732,
+    0xca28a291859bbf93, 0x7d7b8f7503cfdcfe,
+    0xfcb2cb35e702af78, 0x5cda735244c3d43e,
+    0x9defbf01b061adab, 0x3a0888136afa64a7,
+    0xc56baec21c7a1916, 0x088aaa1845b8fdd0,
+    0xf6c69a72a3989f5b, 0x8aad549e57273d45,
+    0x9a3c2087a63f6399, 0x36ac54e2f678864b,
+    0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd,
+    0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5,
+    0x969eb7c47859e743, 0x9f644ae5a4b1b325,
+    0xbc4665b596706114, 0x873d5d9f0dde1fee,
+    0xeb57ff22fc0c7959, 0xa90cb506d155a7ea,
+    0x9316ff75dd87cbd8, 0x09a7f12442d588f2,
+    0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f,
+    0xe5d3ef282a242e81, 0x8f1668c8a86da5fa,
+    0x8fa475791a569d10, 0xf96e017d694487bc,
+    0xb38d92d760ec4455, 0x37c981dcc395a9ac,
+    0xe070f78d3927556a, 0x85bbe253f47b1417,
+    0x8c469ab843b89562, 0x93956d7478ccec8e,
+    0xaf58416654a6babb, 0x387ac8d1970027b2,
+    0xdb2e51bfe9d0696a, 0x06997b05fcc0319e,
+    0x88fcf317f22241e2, 0x441fece3bdf81f03,
+    0xab3c2fddeeaad25a, 0xd527e81cad7626c3,
+    0xd60b3bd56a5586f1, 0x8a71e223d8d3b074,
+    0x85c7056562757456, 0xf6872d5667844e49,
+    0xa738c6bebb12d16c, 0xb428f8ac016561db,
+    0xd106f86e69d785c7, 0xe13336d701beba52,
+    0x82a45b450226b39c, 0xecc0024661173473,
+    0xa34d721642b06084, 0x27f002d7f95d0190,
+    0xcc20ce9bd35c78a5, 0x31ec038df7b441f4,
+    0xff290242c83396ce, 0x7e67047175a15271,
+    0x9f79a169bd203e41, 0x0f0062c6e984d386,
+    0xc75809c42c684dd1, 0x52c07b78a3e60868,
+    0xf92e0c3537826145, 0xa7709a56ccdf8a82,
+    0x9bbcc7a142b17ccb, 0x88a66076400bb691,
+    0xc2abf989935ddbfe, 0x6acff893d00ea435,
+    0xf356f7ebf83552fe, 0x0583f6b8c4124d43,
+    0x98165af37b2153de, 0xc3727a337a8b704a,
+    0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c,
+    0xeda2ee1c7064130c, 0x1162def06f79df73,
+    0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8,
+    0xb9a74a0637ce2ee1, 0x6d953e2bd7173692,
+    0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437,
+    0x910ab1d4db9914a0, 0x1d9c9892400a22a2,
+    0xb54d5e4a127f59c8, 0x2503beb6d00cab4b,
+    0xe2a0b5dc971f303a, 0x2e44ae64840fd61d,
+    0x8da471a9de737e24, 0x5ceaecfed289e5d2,
+    0xb10d8e1456105dad, 0x7425a83e872c5f47,
+    0xdd50f1996b947518, 0xd12f124e28f77719,
+    0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f,
+    0xace73cbfdc0bfb7b, 0x636cc64d1001550b,
+    0xd8210befd30efa5a, 0x3c47f7e05401aa4e,
+    0x8714a775e3e95c78, 0x65acfaec34810a71,
+    0xa8d9d1535ce3b396, 0x7f1839a741a14d0d,
+    0xd31045a8341ca07c, 0x1ede48111209a050,
+    0x83ea2b892091e44d, 0x934aed0aab460432,
+    0xa4e4b66b68b65d60, 0xf81da84d5617853f,
+    0xce1de40642e3f4b9, 0x36251260ab9d668e,
+    0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019,
+    0xa1075a24e4421730, 0xb24cf65b8612f81f,
+    0xc94930ae1d529cfc, 0xdee033f26797b627,
+    0xfb9b7cd9a4a7443c, 0x169840ef017da3b1,
+    0x9d412e0806e88aa5, 0x8e1f289560ee864e,
+    0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2,
+    0xf5b5d7ec8acb58a2, 0xae10af696774b1db,
+    0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29,
+    0xbff610b0cc6edd3f, 0x17fd090a58d32af3,
+    0xeff394dcff8a948e, 0xddfc4b4cef07f5b0,
+    0x95f83d0a1fb69cd9, 0x4abdaf101564f98e,
+    0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1,
+    0xea53df5fd18d5513, 0x84c86189216dc5ed,
+    0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4,
+    0xb7118682dbb66a77, 0x3fbc8c33221dc2a1,
+    0xe4d5e82392a40515, 0x0fabaf3feaa5334a,
+    0x8f05b1163ba6832d, 0x29cb4d87f2a7400e,
+    0xb2c71d5bca9023f8, 0x743e20e9ef511012,
+    0xdf78e4b2bd342cf6, 0x914da9246b255416,
+    0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e,
+    0xae9672aba3d0c320, 0xa184ac2473b529b1,
+    0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e,
+    0x8865899617fb1871, 0x7e2fa67c7a658892,
+    0xaa7eebfb9df9de8d, 0xddbb901b98feeab7,
+    0xd51ea6fa85785631, 0x552a74227f3ea565,
+    0x8533285c936b35de, 0xd53a88958f87275f,
+    0xa67ff273b8460356, 0x8a892abaf368f137,
+    0xd01fef10a657842c, 0x2d2b7569b0432d85,
+    0x8213f56a67f6b29b, 0x9c3b29620e29fc73,
+    0xa298f2c501f45f42, 0x8349f3ba91b47b8f,
+    0xcb3f2f7642717713, 0x241c70a936219a73,
+    0xfe0efb53d30dd4d7, 0xed238cd383aa0110,
+    0x9ec95d1463e8a506, 0xf4363804324a40aa,
+    0xc67bb4597ce2ce48, 0xb143c6053edcd0d5,
+    0xf81aa16fdc1b81da, 0xdd94b7868e94050a,
+    0x9b10a4e5e9913128, 0xca7cf2b4191c8326,
+    0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0,
+    0xf24a01a73cf2dccf, 0xbc633b39673c8cec,
+    0x976e41088617ca01, 0xd5be0503e085d813,
+    0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18,
+    0xec9c459d51852ba2, 0xddf8e7d60ed1219e,
+    0x93e1ab8252f33b45, 0xcabb90e5c942b503,
+    0xb8da1662e7b00a17, 0x3d6a751f3b936243,
+    0xe7109bfba19c0c9d, 0x0cc512670a783ad4,
+    0x906a617d450187e2, 0x27fb2b80668b24c5,
+    0xb484f9dc9641e9da, 0xb1f9f660802dedf6,
+    0xe1a63853bbd26451, 0x5e7873f8a0396973,
+    0x8d07e33455637eb2, 0xdb0b487b6423e1e8,
+    0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62,
+    0xdc5c5301c56b75f7, 0x7641a140cc7810fb,
+    0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d,
+    0xac2820d9623bf429, 0x546345fa9fbdcd44,
+    0xd732290fbacaf133, 0xa97c177947ad4095,
+    0x867f59a9d4bed6c0, 0x49ed8eabcccc485d,
+    0xa81f301449ee8c70, 0x5c68f256bfff5a74,
+    0xd226fc195c6a2f8c, 0x73832eec6fff3111,
+    0x83585d8fd9c25db7, 0xc831fd53c5ff7eab,
+    0xa42e74f3d032f525, 0xba3e7ca8b77f5e55,
+    0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb,
+    0x80444b5e7aa7cf85, 0x7980d163cf5b81b3,
+    0xa0555e361951c366, 0xd7e105bcc332621f,
+    0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7,
+    0xfa856334878fc150, 0xb14f98f6f0feb951,
+    0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3,
+    0xc3b8358109e84f07, 0x0a862f80ec4700c8,
+    0xf4a642e14c6262c8, 0xcd27bb612758c0fa,
+    0x98e7e9cccfbd7dbd, 0x8038d51cb897789c,
+    0xbf21e44003acdd2c, 0xe0470a63e6bd56c3,
+    0xeeea5d5004981478, 0x1858ccfce06cac74,
+    0x95527a5202df0ccb, 0x0f37801e0c43ebc8,
+    0xbaa718e68396cffd, 0xd30560258f54e6ba,
+    0xe950df20247c83fd, 0x47c6b82ef32a2069,
+    0x91d28b7416cdd27e, 0x4cdc331d57fa5441,
+    0xb6472e511c81471d, 0xe0133fe4adf8e952,
+    0xe3d8f9e563a198e5, 0x58180fddd97723a6,
+    0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648,
+};
+
+// exact powers of ten for the fast path of ekonStrToDouble
+static const f64 ekonPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                1e18, 1e19, 1e20, 1e21, 1e22};
+
+// count leading zeros. x must not be 0
+u32 ekonClz64(u64 x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+  unsigned long r;
+  _BitScanReverse64(&r, x);
+  return 63 - (u32)r;
+#elif defined(_MSC_VER)
+  u32 n = 0;
+  while ((x & ((u64)1 << 63)) == 0)
+    x <<= 1, n++;
+  return n;
+#else
+  return (u32)__builtin_clzll(x);
+#endif
 }
 
-int parseInt(const char *str, int len) {
-  int final = 0;
-  int counter = 0;
+// full 64x64->128 bit product. returns the low word, the high in outHigh
+u64 ekonMul128(u64 a, u64 b, u64 *outHigh) {
+#if defined(__SIZEOF_INT128__)
+  __extension__ const unsigned __int128 r = (unsigned __int128)a * b;
+  *outHigh = (u64)(r >> 64);
+  return (u64)r;
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return _umul128(a, b, outHigh);
+#else
+  const u64 aLo = (u32)a, aHi = a >> 32, bLo = (u32)b, bHi = b >> 32;
+  const u64 lo = aLo * bLo, mid1 = aHi * bLo, mid2 = aLo * bHi;
+  const u64 mid = (lo >> 32) + (u32)mid1 + (u32)mid2;
+  *outHigh = aHi * bHi + (mid1 >> 32) + (mid2 >> 32) + (mid >> 32);
+  return (mid << 32) | (u32)lo;
+#endif
+}
 
-  int i;
-  for (i = len - 1; i >= 0; i--) {
-    if (str[i] >= '0' && str[i] <= '9') {
-      final += power(10, counter) * (str[i] - '0');
-      counter++;
-    }
+/**
+ * @brief Eisel-Lemire: round w * 10^q to the nearest double. the 128-bit
+ *        product with 5^q is always enough for w below 10^19 (Mushtak and
+ *        Lemire, "Fast Number Parsing Without Fallback")
+ * @param w   decimal significand, not 0
+ * @param q   decimal exponent
+ * @return    bits of the double
+ * */
+u64 ekonEiselLemire(u64 w, i32 q) {
+  if (q < EKON_POW5_MIN)
+    return 0;
+  if (q > EKON_POW5_MAX)
+    return (u64)0x7FF << 52;
+
+  const u32 lz = ekonClz64(w);
+  w <<= lz;
+  const u64 *pow5 = ekonPow5 + 2 * (q - EKON_POW5_MIN);
+  u64 high;
+  u64 low = ekonMul128(w, pow5[0], &high);
+  // the 9 bits below the 55 that are kept decide if the low word matters
+  if ((high & 0x1FF) == 0x1FF) {
+    u64 secondHigh;
+    ekonMul128(w, pow5[1], &secondHigh);
+    low += secondHigh;
+    high += secondHigh > low;
+  }
+
+  const u32 upperBit = (u32)(high >> 63);
+  const u32 shift = upperBit + 9;
+  u64 mantissa = high >> shift;
+  // floor(q * log2(10)) + 63, minus the bias
+  i32 power2 = (i32)(((152170 + 65536) * q) >> 16) + 63 + (i32)upperBit -
+               (i32)lz + 1023;
+
+  if (power2 <= 0) {
+    // subnormal
+    if (-power2 + 1 >= 64)
+      return 0;
+    mantissa >>= -power2 + 1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    power2 = mantissa < ((u64)1 << 52) ? 0 : 1;
+    return ((u64)power2 << 52) | (mantissa & (((u64)1 << 52) - 1));
   }
 
-  if (str[i + 1] == '-')
-    final = -final;
-  return final;
+  // exactly halfway between two doubles: round to even, not up
+  if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+      (mantissa << shift) == high)
+    mantissa &= ~(u64)1;
+  mantissa += mantissa & 1;
+  mantissa >>= 1;
+  if (mantissa >= ((u64)2 << 52)) {
+    mantissa = (u64)1 << 52;
+    power2++;
+  }
+  if (power2 >= 0x7FF)
+    return (u64)0x7FF << 52;
+  return ((u64)power2 << 52) | (mantissa & (((u64)1 << 52) - 1));
 }
 
-/* str->int convert, returns false for error, outInt stores converted val */
-bool ekonStrToInt(const char *str, int *outInt) {
-  u32 len = 0;
-  if (ekonCheckNum(str, &len) == false)
+/**
+ * @brief convert the digits of a hex, binary or octal number to a double.
+ *        the first 62 or more significant bits are kept, the rest only
+ *        decide the rounding
+ * @param s         first digit
+ * @param len       bytes from `s` to the end of the number
+ * @param bits      bits per digit: 4, 1 or 3
+ * @param outDouble converted value
+ * @return          false if there are no digits or a digit is out of range
+ * */
+bool ekonRadixToDouble(const char *s, u32 len, u32 bits, f64 *outDouble) {
+  u64 m = 0;
+  u32 exp2 = 0;
+  bool sticky = false;
+  bool any = false;
+  for (u32 i = 0; i < len; i++) {
+    const char c = s[i] | 0x20;
+    u32 d;
+    if (c >= '0' && c <= '9')
+      d = c - '0';
+    else if (c >= 'a' && c <= 'f')
+      d = c - 'a' + 10;
+    else if (s[i] == '_')
+      continue;
+    else
+      return false;
+    if (EKON_UNLIKELY(d >> bits != 0))
+      return false;
+    any = true;
+    if ((m >> (64 - bits)) == 0) {
+      m = (m << bits) | d;
+    } else {
+      exp2 += bits;
+      sticky |= d != 0;
+    }
+  }
+  if (EKON_UNLIKELY(any == false))
     return false;
-  *outInt = parseInt(str, len) == false;
+  // m has 62+ bits, so bit 0 is well below the rounding bit of a double
+  f64 d = (f64)(m | (u64)sticky);
+  for (; exp2 >= 32; exp2 -= 32)
+    d *= 4294967296.0;
+  *outDouble = d * (f64)((u64)1 << exp2);
   return true;
 }
 
-/* str->long convert, returns false for error, outInt stores converted val */
-bool ekonStrToLong(const char *str, long *outLong) {
-  u32 counter = 0;
-  u32 i = 0;
-  u32 len = 0;
-  long ii = 0;
-
-  if (ekonCheckNum(str, &len) == false)
-    return false;
+// significant digits the slow path keeps. a halfway point between two
+// doubles has at most 767, the rest only tell if the number is above it
+#define EKON_BIG_DIGITS 780
+// 32-bit limbs of an EkonBig: 780 digits shifted by the 1075 bits of the
+// smallest subnormal, or 5^1125 times 2^55, fit with room to spare
+#define EKON_BIG_LIMBS 128
+
+// unsigned big integer for ekonStrToDoubleSlow, least significant limb first
+typedef struct {
+  u32 limb[EKON_BIG_LIMBS];
+  u32 len; // limbs in use, the top one is not 0
+} EkonBig;
+
+// big = big * mul + add
+void ekonBigMulAdd(EkonBig *big, u32 mul, u32 add) {
+  u64 carry = add;
+  for (u32 i = 0; i < big->len; i++) {
+    carry += (u64)big->limb[i] * mul;
+    big->limb[i] = (u32)carry;
+    carry >>= 32;
+  }
+  if (carry != 0)
+    big->limb[big->len++] = (u32)carry;
+}
+
+// big = big * 10^n
+void ekonBigMulPow10(EkonBig *big, u32 n) {
+  for (; n >= 9; n -= 9)
+    ekonBigMulAdd(big, 1000000000, 0);
+  if (n != 0)
+    ekonBigMulAdd(big, (u32)ekonPow10[n], 0);
+}
+
+// big = big * 2^n
+void ekonBigShl(EkonBig *big, u32 n) {
+  const u32 words = n / 32, bits = n % 32;
+  if (big->len == 0)
+    return;
+  big->limb[big->len] = 0;
+  for (u32 i = big->len + 1; i-- > 0;) {
+    const u32 low = i != 0 && bits != 0 ? big->limb[i - 1] >> (32 - bits) : 0;
+    big->limb[i + words] = (big->limb[i] << bits) | low;
+  }
+  for (u32 i = 0; i < words; i++)
+    big->limb[i] = 0;
+  big->len += words + 1;
+  if (big->limb[big->len - 1] == 0)
+    big->len--;
+}
+
+// -1, 0 or 1 as a is below, equal to or above b
+int ekonBigCmp(const EkonBig *a, const EkonBig *b) {
+  if (a->len != b->len)
+    return a->len < b->len ? -1 : 1;
+  for (u32 i = a->len; i-- > 0;)
+    if (a->limb[i] != b->limb[i])
+      return a->limb[i] < b->limb[i] ? -1 : 1;
+  return 0;
+}
 
-  for (i = len - 1; i >= 0; i--) {
-    if ((str[i] >= '0' && str[i] <= '9')) {
-      ii += power(10, counter) * (str[i] - '0');
-      counter++;
+/**
+ * @brief the exact rounding of a decimal for the rare significands with more
+ *        than 19 digits that Eisel-Lemire cannot round alone. the number is
+ *        either `lo` or the double after it, and the digits are compared with
+ *        the halfway point between the two. no strtod, which reads the
+ *        decimal point from the locale
+ * @param s   number, checked by ekonStrToDouble
+ * @param len length of the number
+ * @param lo  bits of the double its first 19 digits round to
+ * @return    bits of the double
+ * */
+u64 ekonStrToDoubleSlow(const char *s, u32 len, u64 lo) {
+  EkonBig d, h;
+  d.len = 0;
+  i32 exp10 = 0;
+  u32 digits = 0;
+  bool isFraction = false;
+  bool sticky = false;
+  u32 i = 0;
+  if (s[i] == '-' || s[i] == '+')
+    i++;
+  for (; i < len && (s[i] | 0x20) != 'e'; i++) {
+    const char c = s[i];
+    if (c == '_')
+      continue;
+    if (c == '.') {
+      isFraction = true;
+    } else if (digits < EKON_BIG_DIGITS) {
+      if (digits != 0 || c != '0') {
+        ekonBigMulAdd(&d, 10, c - '0');
+        digits++;
+      }
+      exp10 -= isFraction;
+    } else {
+      exp10 += !isFraction;
+      sticky |= c != '0';
     }
   }
-  if (str[i + 1] == '-')
-    *outLong = -ii;
-  return true;
+  if (i < len) {
+    bool isExpNegative = false;
+    if (++i < len && (s[i] == '-' || s[i] == '+'))
+      isExpNegative = s[i++] == '-';
+    i32 e = 0;
+    for (; i < len; i++)
+      if (s[i] != '_' && e < 100000)
+        e = e * 10 + (s[i] - '0');
+    exp10 += isExpNegative ? -e : e;
+  }
+
+  // lo = m * 2^e, the halfway point is (2m + 1) * 2^(e - 1)
+  u64 m = lo & (((u64)1 << 52) - 1);
+  i32 e = -1074;
+  if ((lo >> 52) != 0) {
+    m |= (u64)1 << 52;
+    e = (i32)(lo >> 52) - 1075;
+  }
+  m = 2 * m + 1;
+  h.limb[0] = (u32)m;
+  h.limb[1] = (u32)(m >> 32);
+  h.len = h.limb[1] != 0 ? 2 : 1;
+
+  // d * 10^exp10 against h * 2^(e - 1), both scaled to integers
+  if (exp10 >= 0)
+    ekonBigMulPow10(&d, (u32)exp10);
+  else
+    ekonBigMulPow10(&h, (u32)-exp10);
+  if (e >= 1)
+    ekonBigShl(&h, (u32)(e - 1));
+  else
+    ekonBigShl(&d, (u32)(1 - e));
+
+  int cmp = ekonBigCmp(&d, &h);
+  if (cmp == 0 && sticky)
+    cmp = 1;
+  // exactly halfway: round to even
+  return cmp > 0 || (cmp == 0 && (lo & 1) != 0) ? lo + 1 : lo;
 }
 
-/* str->ll convert, returns false for error, outInt stores converted val */
-bool ekonStrToLongLong(const char *str, long long *outLongLong) {
-  u32 counter = 0;
+/**
+ * @brief convert a number to the nearest double. takes every form of an EKON
+ *        number: a `+` or `-` sign, `_` separators, `.5` and `5.`, exponents,
+ *        and 0x, 0b and 0o literals
+ * @param s         number
+ * @param len       length of the number
+ * @param outDouble converted value
+ * @return          false if `s` is not a number (or out of memory)
+ * */
+bool ekonStrToDouble(const char *s, u32 len, f64 *outDouble) {
   u32 i = 0;
-  u32 len = 0;
-  long long ii = 0;
+  bool isNegative = false;
+  if (i < len && (s[i] == '-' || s[i] == '+'))
+    isNegative = s[i++] == '-';
+
+  f64 d;
+  if (i + 1 < len && s[i] == '0' &&
+      ((s[i + 1] | 0x20) == 'x' || (s[i + 1] | 0x20) == 'b' ||
+       (s[i + 1] | 0x20) == 'o')) {
+    const char radix = s[i + 1] | 0x20;
+    const u32 bits = radix == 'x' ? 4 : radix == 'b' ? 1 : 3;
+    if (ekonRadixToDouble(s + i + 2, len - i - 2, bits, &d) == false)
+      return false;
+    *outDouble = isNegative ? -d : d;
+    return true;
+  }
 
-  if (ekonCheckNum(str, &len) == false)
+  // the first 19 significant digits go into w, the rest only move the
+  // exponent and mark w as truncated
+  u64 w = 0;
+  u32 digits = 0;
+  i32 exp10 = 0;
+  bool truncated = false;
+  bool any = false;
+  for (; i < len; i++) {
+    const char c = s[i];
+    if (c == '_')
+      continue;
+    if ((u8)(c - '0') > 9)
+      break;
+    any = true;
+    if (digits < 19) {
+      w = w * 10 + (c - '0');
+      digits += w != 0;
+    } else {
+      exp10++;
+      truncated |= c != '0';
+    }
+  }
+  if (i < len && s[i] == '.') {
+    for (i++; i < len; i++) {
+      const char c = s[i];
+      if (c == '_')
+        continue;
+      if ((u8)(c - '0') > 9)
+        break;
+      any = true;
+      if (digits < 19) {
+        w = w * 10 + (c - '0');
+        digits += w != 0;
+        exp10--;
+      } else {
+        truncated |= c != '0';
+      }
+    }
+  }
+  if (EKON_UNLIKELY(any == false))
     return false;
 
-  for (i = len - 1; i >= 0; i--) {
-    if ((str[i] >= '0' && str[i] <= '9')) {
-      ii += power(10, counter) * (str[i] - '0');
-      counter++;
+  if (i < len && (s[i] | 0x20) == 'e') {
+    bool isExpNegative = false;
+    if (++i < len && (s[i] == '-' || s[i] == '+'))
+      isExpNegative = s[i++] == '-';
+    i32 e = 0;
+    bool anyExp = false;
+    for (; i < len; i++) {
+      const char c = s[i];
+      if (c == '_')
+        continue;
+      if ((u8)(c - '0') > 9)
+        break;
+      anyExp = true;
+      if (e < 100000) // far beyond any double, and no overflow
+        e = e * 10 + (c - '0');
     }
+    if (EKON_UNLIKELY(anyExp == false))
+      return false;
+    exp10 += isExpNegative ? -e : e;
+  }
+  if (EKON_UNLIKELY(i != len))
+    return false;
+
+  if (w == 0) {
+    d = 0;
+  } else if (truncated == false && exp10 >= -22 && exp10 <= 22 &&
+             w <= (u64)1 << 53) {
+    // Clinger's fast path: w and 10^|exp10| are exact doubles, so one
+    // correctly rounded multiplication or division is the answer
+    d = (f64)w;
+    d = exp10 < 0 ? d / ekonPow10[-exp10] : d * ekonPow10[exp10];
+  } else {
+    u64 bits = ekonEiselLemire(w, exp10);
+    // the true significand is between w and w + 1
+    if (EKON_UNLIKELY(truncated) && bits != ekonEiselLemire(w + 1, exp10))
+      bits = ekonStrToDoubleSlow(s, len, bits);
+    memcpy(&d, &bits, sizeof(d));
   }
-  if (str[i + 1] == '-')
-    *outLongLong = -ii;
+  *outDouble = isNegative ? -d : d;
   return true;
 }
 
-/* str->double convert, returns false for error, outInt stores converted val */
-bool ekonStrToDouble(const char *str, f64 *outDouble) {
-  u32 len = 0;
-  if (ekonCheckNum(str, &len) == false)
+// result of ekonStrToI64
+typedef enum {
+  EKON_INT_OK,      // an integer that fits in an i64
+  EKON_INT_NOT_INT, // a fraction, an exponent or not a number at all
+  EKON_INT_OVERFLOW // an integer outside the range of an i64
+} EkonIntStatus;
+
+// the 8-digit loads of ekonParse8Digits read the digits little-endian
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define EKON_NO_SWAR
+#endif
+
+/**
+ * @brief read 8 decimal digits at once (SWAR)
+ * @param s         8 readable bytes
+ * @param outValue  their value, if they are all digits
+ * @return          false if a byte is not a digit
+ * */
+bool ekonParse8Digits(const char *s, u32 *outValue) {
+  u64 x;
+  memcpy(&x, s, sizeof(x));
+  // a digit has 3 as its high nibble, and adding 6 keeps it below 0x40
+  if (((x & 0xF0F0F0F0F0F0F0F0ULL) |
+       (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) !=
+      0x3333333333333333ULL)
     return false;
-  bool isNegative = 0;
-  bool isExpNegative = 0;
-  int intRange[2] = {-1, -1};
-  int decRange[2] = {-1, -1};
-  int expRange[2] = {-1, -1};
-  int i = 0;
-
-  if (str[i] == '-' || str[i] == '+') {
-    if (str[i] == '-')
-      isNegative = 1;
-    i++;
-  }
+  x -= 0x3030303030303030ULL;
+  x = x * 10 + (x >> 8); // pairs of digits
+  x = (((x & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+       (((x >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+      32;
+  *outValue = (u32)x;
+  return true;
+}
 
-  intRange[0] = i;
-  while (i <= len) {
-    if ((str[i] >= '0' && str[i] <= '9') || str[i] == '_')
-      i++;
-    else {
-      intRange[1] = i - 1;
+/**
+ * @brief convert an integer to an i64. decimal digits are read 8 at a time
+ *        when no `_` is in the way, 0x, 0b and 0o literals by shifting
+ * @param s         number, with an optional sign
+ * @param len       length of the number
+ * @param outInt    converted value, if EKON_INT_OK
+ * @param outKind   EKON_IS_NUM_INT, _HEXADECIMAL, _BINARY or _OCTAL
+ * @return          EKON_INT_OK, EKON_INT_NOT_INT or EKON_INT_OVERFLOW
+ * */
+EkonIntStatus ekonStrToI64(const char *s, u32 len, i64 *outInt,
+                           EkonOption *outKind) {
+  u32 i = 0;
+  bool isNegative = false;
+  if (i < len && (s[i] == '-' || s[i] == '+'))
+    isNegative = s[i++] == '-';
+
+  u32 bits = 0; // bits per digit of a 0x, 0b or 0o literal
+  *outKind = EKON_IS_NUM_INT;
+  if (i + 1 < len && s[i] == '0') {
+    switch (s[i + 1] | 0x20) {
+    case 'x':
+      bits = 4, *outKind = EKON_IS_NUM_HEXADECIMAL;
+      break;
+    case 'b':
+      bits = 1, *outKind = EKON_IS_NUM_BINARY;
+      break;
+    case 'o':
+      bits = 3, *outKind = EKON_IS_NUM_OCTAL;
       break;
     }
-  }
-
-  if (str[i] == '.') {
-    i++;
-    decRange[0] = i;
-    while (i <= len) {
-      if ((str[i] >= '0' && str[i] <= '9') || str[i] == '_')
+    if (bits != 0)
+      i += 2;
+  }
+
+  u64 m = 0;
+  bool any = false;
+  bool overflow = false;
+  if (bits == 0) {
+    while (i < len) {
+#if !defined(EKON_NO_SWAR)
+      u32 eight;
+      if (i + 8 <= len && ekonParse8Digits(s + i, &eight)) {
+        // UINT64_MAX is 184467440737 * 10^8 + 9551615
+        overflow |= m > 184467440737ULL ||
+                    (m == 184467440737ULL && eight > 9551615);
+        m = m * 100000000 + eight;
+        any = true;
+        i += 8;
+        continue;
+      }
+#endif
+      const char c = s[i];
+      if (c == '_') {
         i++;
-      else {
-        decRange[1] = i - 1;
-        break;
+        continue;
       }
-    }
-  }
-
-  if (str[i] == 'e' || str[i] == 'E') {
-    i++;
-    if (str[i] == '-' || str[i] == '+') {
-      if (str[i] == '-')
-        isExpNegative = true;
+      if ((u8)(c - '0') > 9)
+        break;
+      // UINT64_MAX is 1844674407370955161 * 10 + 5
+      overflow |= m > 1844674407370955161ULL ||
+                  (m == 1844674407370955161ULL && c > '5');
+      m = m * 10 + (c - '0');
+      any = true;
       i++;
     }
-
-    expRange[0] = i;
-    while (i <= len) {
-      if ((str[i] >= '0' && str[i] <= '9') || str[i] == '_')
-        i++;
-      else {
-        expRange[1] = i - 1;
+  } else {
+    for (; i < len; i++) {
+      const char c = s[i] | 0x20;
+      u32 d;
+      if (c >= '0' && c <= '9')
+        d = c - '0';
+      else if (c >= 'a' && c <= 'f')
+        d = c - 'a' + 10;
+      else if (s[i] == '_')
+        continue;
+      else
         break;
-      }
+      if (EKON_UNLIKELY(d >> bits != 0))
+        return EKON_INT_NOT_INT;
+      overflow |= (m >> (64 - bits)) != 0;
+      m = (m << bits) | d;
+      any = true;
     }
   }
 
-  int integer = parseInt(str + intRange[0], intRange[1] - intRange[0] + 1);
-  int decimal = parseInt(str + decRange[0], decRange[1] - decRange[0] + 1);
-  int exp = parseInt(str + expRange[0], expRange[1] - expRange[0] + 1);
+  if (EKON_UNLIKELY(i != len || any == false))
+    return EKON_INT_NOT_INT;
+  if (EKON_UNLIKELY(overflow || m > (u64)INT64_MAX + isNegative))
+    return EKON_INT_OVERFLOW;
+  *outInt = isNegative ? (i64)(0 - m) : (i64)m;
+  return EKON_INT_OK;
+}
+
+// number type bits of EkonOption
+#define EKON_IS_NUM_TYPE                                                      \
+  (EKON_IS_NUM_BINARY | EKON_IS_NUM_OCTAL | EKON_IS_NUM_DECIMAL |             \
+   EKON_IS_NUM_HEXADECIMAL | EKON_IS_NUM_FLOAT | EKON_IS_NUM_INT |            \
+   EKON_IS_NUM_OVERFLOW)
+
+/**
+ * @brief decode a EKON_TYPE_NUMBER node into `node->num` and tag it with
+ *        EKON_IS_NUM_CACHED and the EKON_IS_NUM_* bit of its kind. only the
+ *        first call reads the digits, later calls are a flag test.
+ *        integers that do not fit in an i64 are stored as doubles, tagged
+ *        EKON_IS_NUM_OVERFLOW so that integer reads still fail on them
+ * @param node    number node
+ * @return        false if the text is not a number or out of memory
+ * */
+bool ekonNodeNum(EkonNode *node) {
+  if (EKON_LIKELY((node->option & EKON_IS_NUM_CACHED) != 0))
+    return true;
+
+  EkonOption kind;
+  const EkonIntStatus status =
+      ekonStrToI64(node->value.str, node->len, &node->num.i, &kind);
+  if (EKON_UNLIKELY(status != EKON_INT_OK)) {
+    // a fraction, an exponent, `.5` or too large for an i64. the double of
+    // an integer just past INT64_MIN rounds to INT64_MIN, so the overflow
+    // has to be kept apart
+    kind = status == EKON_INT_OVERFLOW
+               ? EKON_IS_NUM_FLOAT | EKON_IS_NUM_OVERFLOW
+               : EKON_IS_NUM_FLOAT;
+    if (EKON_UNLIKELY(ekonStrToDouble(node->value.str, node->len,
+                                      &node->num.d) == false))
+      return false;
+  }
+
+  node->option &= ~EKON_IS_NUM_TYPE;
+  node->option |= kind | EKON_IS_NUM_CACHED;
+  return true;
+}
 
-  int decimalRange = 0;
-  for (int i = decRange[0]; i <= decRange[1]; i++) {
-    if (str[i] >= '0' && str[i] <= '9')
-      decimalRange--;
+/**
+ * @brief read a number node as an integer in [min, max]. floats are
+ *        truncated, integer literals out of the range of an i64 fail
+ * @param node    number node
+ * @param min     smallest value that fits
+ * @param max     largest value that fits
+ * @param outInt  converted value
+ * @return        false if it is not a number or out of range
+ * */
+bool ekonNodeNumInt(EkonNode *node, i64 min, i64 max, i64 *outInt) {
+  if (EKON_UNLIKELY(ekonNodeNum(node) == false))
+    return false;
+  if (EKON_UNLIKELY((node->option & EKON_IS_NUM_FLOAT) != 0)) {
+    if (EKON_UNLIKELY((node->option & EKON_IS_NUM_OVERFLOW) != 0))
+      return false;
+    const f64 d = node->num.d;
+    // -min is a power of two, so exact as a double, unlike max
+    if (!(d >= (f64)min && d < -(f64)min))
+      return false;
+    *outInt = (i64)d;
+  } else {
+    *outInt = node->num.i;
   }
+  return *outInt >= min && *outInt <= max;
+}
+
+// "00" to "99", for writing two digits at a time
+static const char ekonDigitPairs[201] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334"
+    "3536373839404142434445464748495051525354555657585960616263646566676869"
+    "707172737475767778798081828384858687888990919293949596979899";
 
-  float final = (integer + power(10, decimalRange) * decimal) * power(10, exp);
+/**
+ * @brief write the decimal digits of n and a '\0'
+ * @param n     number
+ * @param buff  at least 21 bytes
+ * @return      number of digits
+ * */
+u32 ekonU64ToStr(u64 n, char *buff) {
+  char tmp[20];
+  char *p = tmp + sizeof(tmp);
+  while (n >= 100) {
+    const u32 r = (u32)(n % 100);
+    n /= 100;
+    p -= 2;
+    memcpy(p, ekonDigitPairs + 2 * r, 2);
+  }
+  if (n >= 10) {
+    p -= 2;
+    memcpy(p, ekonDigitPairs + 2 * n, 2);
+  } else {
+    *--p = (char)('0' + n);
+  }
+  const u32 len = (u32)(tmp + sizeof(tmp) - p);
+  memcpy(buff, p, len);
+  buff[len] = 0;
+  return len;
+}
 
-  return isNegative ? -final : final;
+// i64->str. buff must hold 21 bytes
+u32 ekonI64ToStr(i64 n, char *buff) {
+  if (n >= 0)
+    return ekonU64ToStr((u64)n, buff);
+  buff[0] = '-';
+  return 1 + ekonU64ToStr(0 - (u64)n, buff + 1);
 }
 
 /* int->str  */
-u32 ekonIntToStr(int n, char *buff) { return snprintf(buff, 12, "%d", n); }
+u32 ekonIntToStr(int n, char *buff) { return ekonI64ToStr(n, buff); }
 
 /* long->str  */
-u32 ekonLongToStr(long n, char *buff) { return snprintf(buff, 24, "%ld", n); }
+u32 ekonLongToStr(long n, char *buff) { return ekonI64ToStr(n, buff); }
 
 /* longLong->str  */
 u32 ekonLongLongToStr(long long n, char *buff) {
-  return snprintf(buff, 24, "%lld", n);
-}
+  return ekonI64ToStr(n, buff);
+}
+
+// 10^k rounded up to 128 bits, for k in [EKON_POW10_UP_MIN,
+// EKON_POW10_UP_MAX]. normalized like ekonPow5, high word first
+#define EKON_POW10_UP_MIN (-292)
+#define EKON_POW10_UP_MAX 326
+static const u64 ekonPow10Up[2 * (EKON_POW10_UP_MAX - EKON_POW10_UP_MIN + 1)] =
+    {
+    0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7b,
+    0x9faacf3df73609b1, 0x77b191618c54e9ad,
+    0xc795830d75038c1d, 0xd59df5b9ef6a2418,
+    0xf97ae3d0d2446f25, 0x4b0573286b44ad1e,
+    0x9becce62836ac577, 0x4ee367f9430aec33,
+    0xc2e801fb244576d5, 0x229c41f793cda740,
+    0xf3a20279ed56d48a, 0x6b43527578c11110,
+    0x9845418c345644d6, 0x830a13896b78aaaa,
+    0xbe5691ef416bd60c, 0x23cc986bc656d554,
+    0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa9,
+    0x94b3a202eb1c3f39, 0x7bf7d71432f3d6aa,
+    0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc54,
+    0xe858ad248f5c22c9, 0xd1b3400f8f9cff69,
+    0x91376c36d99995be, 0x23100809b9c21fa2,
+    0xb58547448ffffb2d, 0xabd40a0c2832a78b,
+    0xe2e69915b3fff9f9, 0x16c90c8f323f516d,
+    0x8dd01fad907ffc3b, 0xae3da7d97f6792e4,
+    0xb1442798f49ffb4a, 0x99cd11cfdf41779d,
+    0xdd95317f31c7fa1d, 0x40405643d711d584,
+    0x8a7d3eef7f1cfc52, 0x482835ea666b2573,
+    0xad1c8eab5ee43b66, 0xda3243650005eed0,
+    0xd863b256369d4a40, 0x90bed43e40076a83,
+    0x873e4f75e2224e68, 0x5a7744a6e804a292,
+    0xa90de3535aaae202, 0x711515d0a205cb37,
+    0xd3515c2831559a83, 0x0d5a5b44ca873e04,
+    0x8412d9991ed58091, 0xe858790afe9486c3,
+    0xa5178fff668ae0b6, 0x626e974dbe39a873,
+    0xce5d73ff402d98e3, 0xfb0a3d212dc81290,
+    0x80fa687f881c7f8e, 0x7ce66634bc9d0b9a,
+    0xa139029f6a239f72, 0x1c1fffc1ebc44e81,
+    0xc987434744ac874e, 0xa327ffb266b56221,
+    0xfbe9141915d7a922, 0x4bf1ff9f0062baa9,
+    0x9d71ac8fada6c9b5, 0x6f773fc3603db4aa,
+    0xc4ce17b399107c22, 0xcb550fb4384d21d4,
+    0xf6019da07f549b2b, 0x7e2a53a146606a49,
+    0x99c102844f94e0fb, 0x2eda7444cbfc426e,
+    0xc0314325637a1939, 0xfa911155fefb5309,
+    0xf03d93eebc589f88, 0x793555ab7eba27cb,
+    0x96267c7535b763b5, 0x4bc1558b2f3458df,
+    0xbbb01b9283253ca2, 0x9eb1aaedfb016f17,
+    0xea9c227723ee8bcb, 0x465e15a979c1cadd,
+    0x92a1958a7675175f, 0x0bfacd89ec191eca,
+    0xb749faed14125d36, 0xcef980ec671f667c,
+    0xe51c79a85916f484, 0x82b7e12780e7401b,
+    0x8f31cc0937ae58d2, 0xd1b2ecb8b0908811,
+    0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa16,
+    0xdfbdcece67006ac9, 0x67a791e093e1d49b,
+    0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e1,
+    0xaecc49914078536d, 0x58fae9f773886e19,
+    0xda7f5bf590966848, 0xaf39a475506a899f,
+    0x888f99797a5e012d, 0x6d8406c952429604,
+    0xaab37fd7d8f58178, 0xc8e5087ba6d33b84,
+    0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a65,
+    0x855c3be0a17fcd26, 0x5cf2eea09a550680,
+    0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481f,
+    0xd0601d8efc57b08b, 0xf13b94daf124da27,
+    0x823c12795db6ce57, 0x76c53d08d6b70859,
+    0xa2cb1717b52481ed, 0x54768c4b0c64ca6f,
+    0xcb7ddcdda26da268, 0xa9942f5dcf7dfd0a,
+    0xfe5d54150b090b02, 0xd3f93b35435d7c4d,
+    0x9efa548d26e5a6e1, 0xc47bc5014a1a6db0,
+    0xc6b8e9b0709f109a, 0x359ab6419ca1091c,
+    0xf867241c8cc6d4c0, 0xc30163d203c94b63,
+    0x9b407691d7fc44f8, 0x79e0de63425dcf1e,
+    0xc21094364dfb5636, 0x985915fc12f542e5,
+    0xf294b943e17a2bc4, 0x3e6f5b7b17b2939e,
+    0x979cf3ca6cec5b5a, 0xa705992ceecf9c43,
+    0xbd8430bd08277231, 0x50c6ff782a838354,
+    0xece53cec4a314ebd, 0xa4f8bf5635246429,
+    0x940f4613ae5ed136, 0x871b7795e136be9a,
+    0xb913179899f68584, 0x28e2557b59846e40,
+    0xe757dd7ec07426e5, 0x331aeada2fe589d0,
+    0x9096ea6f3848984f, 0x3ff0d2c85def7622,
+    0xb4bca50b065abe63, 0x0fed077a756b53aa,
+    0xe1ebce4dc7f16dfb, 0xd3e8495912c62895,
+    0x8d3360f09cf6e4bd, 0x64712dd7abbbd95d,
+    0xb080392cc4349dec, 0xbd8d794d96aacfb4,
+    0xdca04777f541c567, 0xecf0d7a0fc5583a1,
+    0x89e42caaf9491b60, 0xf41686c49db57245,
+    0xac5d37d5b79b6239, 0x311c2875c522ced6,
+    0xd77485cb25823ac7, 0x7d633293366b828c,
+    0x86a8d39ef77164bc, 0xae5dff9c02033198,
+    0xa8530886b54dbdeb, 0xd9f57f830283fdfd,
+    0xd267caa862a12d66, 0xd072df63c324fd7c,
+    0x8380dea93da4bc60, 0x4247cb9e59f71e6e,
+    0xa46116538d0deb78, 0x52d9be85f074e609,
+    0xcd795be870516656, 0x67902e276c921f8c,
+    0x806bd9714632dff6, 0x00ba1cd8a3db53b7,
+    0xa086cfcd97bf97f3, 0x80e8a40eccd228a5,
+    0xc8a883c0fdaf7df0, 0x6122cd128006b2ce,
+    0xfad2a4b13d1b5d6c, 0x796b805720085f82,
+    0x9cc3a6eec6311a63, 0xcbe3303674053bb1,
+    0xc3f490aa77bd60fc, 0xbedbfc4411068a9d,
+    0xf4f1b4d515acb93b, 0xee92fb5515482d45,
+    0x991711052d8bf3c5, 0x751bdd152d4d1c4b,
+    0xbf5cd54678eef0b6, 0xd262d45a78a0635e,
+    0xef340a98172aace4, 0x86fb897116c87c35,
+    0x9580869f0e7aac0e, 0xd45d35e6ae3d4da1,
+    0xbae0a846d2195712, 0x8974836059cca10a,
+    0xe998d258869facd7, 0x2bd1a438703fc94c,
+    0x91ff83775423cc06, 0x7b6306a34627ddd0,
+    0xb67f6455292cbf08, 0x1a3bc84c17b1d543,
+    0xe41f3d6a7377eeca, 0x20caba5f1d9e4a94,
+    0x8e938662882af53e, 0x547eb47b7282ee9d,
+    0xb23867fb2a35b28d, 0xe99e619a4f23aa44,
+    0xdec681f9f4c31f31, 0x6405fa00e2ec94d5,
+    0x8b3c113c38f9f37e, 0xde83bc408dd3dd05,
+    0xae0b158b4738705e, 0x9624ab50b148d446,
+    0xd98ddaee19068c76, 0x3badd624dd9b0958,
+    0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d7,
+    0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4d,
+    0xd47487cc8470652b, 0x7647c32000696720,
+    0x84c8d4dfd2c63f3b, 0x29ecd9f40041e074,
+    0xa5fb0a17c777cf09, 0xf468107100525891,
+    0xcf79cc9db955c2cc, 0x7182148d4066eeb5,
+    0x81ac1fe293d599bf, 0xc6f14cd848405531,
+    0xa21727db38cb002f, 0xb8ada00e5a506a7d,
+    0xca9cf1d206fdc03b, 0xa6d90811f0e4851d,
+    0xfd442e4688bd304a, 0x908f4a166d1da664,
+    0x9e4a9cec15763e2e, 0x9a598e4e043287ff,
+    0xc5dd44271ad3cdba, 0x40eff1e1853f29fe,
+    0xf7549530e188c128, 0xd12bee59e68ef47d,
+    0x9a94dd3e8cf578b9, 0x82bb74f8301958cf,
+    0xc13a148e3032d6e7, 0xe36a52363c1faf02,
+    0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac2,
+    0x96f5600f15a7b7e5, 0x29ab103a5ef8c0ba,
+    0xbcb2b812db11a5de, 0x7415d448f6b6f0e8,
+    0xebdf661791d60f56, 0x111b495b3464ad22,
+    0x936b9fcebb25c995, 0xcab10dd900beec35,
+    0xb84687c269ef3bfb, 0x3d5d514f40eea743,
+    0xe65829b3046b0afa, 0x0cb4a5a3112a5113,
+    0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ac,
+    0xb3f4e093db73a093, 0x59ed216765690f57,
+    0xe0f218b8d25088b8, 0x306869c13ec3532d,
+    0x8c974f7383725573, 0x1e414218c73a13fc,
+    0xafbd2350644eeacf, 0xe5d1929ef90898fb,
+    0xdbac6c247d62a583, 0xdf45f746b74abf3a,
+    0x894bc396ce5da772, 0x6b8bba8c328eb784,
+    0xab9eb47c81f5114f, 0x066ea92f3f326565,
+    0xd686619ba27255a2, 0xc80a537b0efefebe,
+    0x8613fd0145877585, 0xbd06742ce95f5f37,
+    0xa798fc4196e952e7, 0x2c48113823b73705,
+    0xd17f3b51fca3a7a0, 0xf75a15862ca504c6,
+    0x82ef85133de648c4, 0x9a984d73dbe722fc,
+    0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebbb,
+    0xcc963fee10b7d1b3, 0x318df905079926a9,
+    0xffbbcfe994e5c61f, 0xfdf17746497f7053,
+    0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa634,
+    0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc1,
+    0xf9bd690a1b68637b, 0x3dfdce7aa3c673b1,
+    0x9c1661a651213e2d, 0x06bea10ca65c084f,
+    0xc31bfa0fe5698db8, 0x486e494fcff30a63,
+    0xf3e2f893dec3f126, 0x5a89dba3c3efccfb,
+    0x986ddb5c6b3a76b7, 0xf89629465a75e01d,
+    0xbe89523386091465, 0xf6bbb397f1135824,
+    0xee2ba6c0678b597f, 0x746aa07ded582e2d,
+    0x94db483840b717ef, 0xa8c2a44eb4571cdd,
+    0xba121a4650e4ddeb, 0x92f34d62616ce414,
+    0xe896a0d7e51e1566, 0x77b020baf9c81d18,
+    0x915e2486ef32cd60, 0x0ace1474dc1d122f,
+    0xb5b5ada8aaff80b8, 0x0d819992132456bb,
+    0xe3231912d5bf60e6, 0x10e1fff697ed6c6a,
+    0x8df5efabc5979c8f, 0xca8d3ffa1ef463c2,
+    0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb3,
+    0xddd0467c64bce4a0, 0xac7cb3f6d05ddbdf,
+    0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96c,
+    0xad4ab7112eb3929d, 0x86c16c98d2c953c7,
+    0xd89d64d57a607744, 0xe871c7bf077ba8b8,
+    0x87625f056c7c4a8b, 0x11471cd764ad4973,
+    0xa93af6c6c79b5d2d, 0xd598e40d3dd89bd0,
+    0xd389b47879823479, 0x4aff1d108d4ec2c4,
+    0x843610cb4bf160cb, 0xcedf722a585139bb,
+    0xa54394fe1eedb8fe, 0xc2974eb4ee658829,
+    0xce947a3da6a9273e, 0x733d226229feea33,
+    0x811ccc668829b887, 0x0806357d5a3f5260,
+    0xa163ff802a3426a8, 0xca07c2dcb0cf26f8,
+    0xc9bcff6034c13052, 0xfc89b393dd02f0b6,
+    0xfc2c3f3841f17c67, 0xbbac2078d443ace3,
+    0x9d9ba7832936edc0, 0xd54b944b84aa4c0e,
+    0xc5029163f384a931, 0x0a9e795e65d4df12,
+    0xf64335bcf065d37d, 0x4d4617b5ff4a16d6,
+    0x99ea0196163fa42e, 0x504bced1bf8e4e46,
+    0xc06481fb9bcf8d39, 0xe45ec2862f71e1d7,
+    0xf07da27a82c37088, 0x5d767327bb4e5a4d,
+    0x964e858c91ba2655, 0x3a6a07f8d510f870,
+    0xbbe226efb628afea, 0x890489f70a55368c,
+    0xeadab0aba3b2dbe5, 0x2b45ac74ccea842f,
+    0x92c8ae6b464fc96f, 0x3b0b8bc90012929e,
+    0xb77ada0617e3bbcb, 0x09ce6ebb40173745,
+    0xe55990879ddcaabd, 0xcc420a6a101d0516,
+    0x8f57fa54c2a9eab6, 0x9fa946824a12232e,
+    0xb32df8e9f3546564, 0x47939822dc96abfa,
+    0xdff9772470297ebd, 0x59787e2b93bc56f8,
+    0x8bfbea76c619ef36, 0x57eb4edb3c55b65b,
+    0xaefae51477a06b03, 0xede622920b6b23f2,
+    0xdab99e59958885c4, 0xe95fab368e45ecee,
+    0x88b402f7fd75539b, 0x11dbcb0218ebb415,
+    0xaae103b5fcd2a881, 0xd652bdc29f26a11a,
+    0xd59944a37c0752a2, 0x4be76d3346f04960,
+    0x857fcae62d8493a5, 0x6f70a4400c562ddc,
+    0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb953,
+    0xd097ad07a71f26b2, 0x7e2000a41346a7a8,
+    0x825ecc24c873782f, 0x8ed400668c0c28c9,
+    0xa2f67f2dfa90563b, 0x728900802f0f32fb,
+    0xcbb41ef979346bca, 0x4f2b40a03ad2ffba,
+    0xfea126b7d78186bc, 0xe2f610c84987bfa9,
+    0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7ca,
+    0xc6ede63fa05d3143, 0x91503d1c79720dbc,
+    0xf8a95fcf88747d94, 0x75a44c6397ce912b,
+    0x9b69dbe1b548ce7c, 0xc986afbe3ee11abb,
+    0xc24452da229b021b, 0xfbe85badce996169,
+    0xf2d56790ab41c2a2, 0xfae27299423fb9c4,
+    0x97c560ba6b0919a5, 0xdccd879fc967d41b,
+    0xbdb6b8e905cb600f, 0x5400e987bbc1c921,
+    0xed246723473e3813, 0x290123e9aab23b69,
+    0x9436c0760c86e30b, 0xf9a0b6720aaf6522,
+    0xb94470938fa89bce, 0xf808e40e8d5b3e6a,
+    0xe7958cb87392c2c2, 0xb60b1d1230b20e05,
+    0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c3,
+    0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af4,
+    0xe2280b6c20dd5232, 0x25c6da63c38de1b1,
+    0x8d590723948a535f, 0x579c487e5a38ad0f,
+    0xb0af48ec79ace837, 0x2d835a9df0c6d852,
+    0xdcdb1b2798182244, 0xf8e431456cf88e66,
+    0x8a08f0f8bf0f156b, 0x1b8e9ecb641b5900,
+    0xac8b2d36eed2dac5, 0xe272467e3d222f40,
+    0xd7adf884aa879177, 0x5b0ed81dcc6abb10,
+    0x86ccbb52ea94baea, 0x98e947129fc2b4ea,
+    0xa87fea27a539e9a5, 0x3f2398d747b36225,
+    0xd29fe4b18e88640e, 0x8eec7f0d19a03aae,
+    0x83a3eeeef9153e89, 0x1953cf68300424ad,
+    0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd8,
+    0xcdb02555653131b6, 0x3792f412cb06794e,
+    0x808e17555f3ebf11, 0xe2bbd88bbee40bd1,
+    0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec5,
+    0xc8de047564d20a8b, 0xf245825a5a445276,
+    0xfb158592be068d2e, 0xeed6e2f0f0d56713,
+    0x9ced737bb6c4183d, 0x55464dd69685606c,
+    0xc428d05aa4751e4c, 0xaa97e14c3c26b887,
+    0xf53304714d9265df, 0xd53dd99f4b3066a9,
+    0x993fe2c6d07b7fab, 0xe546a8038efe402a,
+    0xbf8fdb78849a5f96, 0xde98520472bdd034,
+    0xef73d256a5c0f77c, 0x963e66858f6d4441,
+    0x95a8637627989aad, 0xdde7001379a44aa9,
+    0xbb127c53b17ec159, 0x5560c018580d5d53,
+    0xe9d71b689dde71af, 0xaab8f01e6e10b4a7,
+    0x9226712162ab070d, 0xcab3961304ca70e9,
+    0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d23,
+    0xe45c10c42a2b3b05, 0x8cb89a7db77c506b,
+    0x8eb98a7a9a5b04e3, 0x77f3608e92adb243,
+    0xb267ed1940f1c61c, 0x55f038b237591ed4,
+    0xdf01e85f912e37a3, 0x6b6c46dec52f6689,
+    0x8b61313bbabce2c6, 0x2323ac4b3b3da016,
+    0xae397d8aa96c1b77, 0xabec975e0a0d081b,
+    0xd9c7dced53c72255, 0x96e7bd358c904a22,
+    0x881cea14545c7575, 0x7e50d64177da2e55,
+    0xaa242499697392d2, 0xdde50bd1d5d0b9ea,
+    0xd4ad2dbfc3d07787, 0x955e4ec64b44e865,
+    0x84ec3c97da624ab4, 0xbd5af13bef0b113f,
+    0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58f,
+    0xcfb11ead453994ba, 0x67de18eda5814af3,
+    0x81ceb32c4b43fcf4, 0x80eacf948770ced8,
+    0xa2425ff75e14fc31, 0xa1258379a94d028e,
+    0xcad2f7f5359a3b3e, 0x096ee45813a04331,
+    0xfd87b5f28300ca0d, 0x8bca9d6e188853fd,
+    0x9e74d1b791e07e48, 0x775ea264cf55347e,
+    0xc612062576589dda, 0x95364afe032a819e,
+    0xf79687aed3eec551, 0x3a83ddbd83f52205,
+    0x9abe14cd44753b52, 0xc4926a9672793543,
+    0xc16d9a0095928a27, 0x75b7053c0f178294,
+    0xf1c90080baf72cb1, 0x5324c68b12dd6339,
+    0x971da05074da7bee, 0xd3f6fc16ebca5e04,
+    0xbce5086492111aea, 0x88f4bb1ca6bcf585,
+    0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6,
+    0x9392ee8e921d5d07, 0x3aff322e62439fd0,
+    0xb877aa3236a4b449, 0x09befeb9fad487c3,
+    0xe69594bec44de15b, 0x4c2ebe687989a9b4,
+    0x901d7cf73ab0acd9, 0x0f9d37014bf60a11,
+    0xb424dc35095cd80f, 0x538484c19ef38c95,
+    0xe12e13424bb40e13, 0x2865a5f206b06fba,
+    0x8cbccc096f5088cb, 0xf93f87b7442e45d4,
+    0xafebff0bcb24aafe, 0xf78f69a51539d749,
+    0xdbe6fecebdedd5be, 0xb573440e5a884d1c,
+    0x89705f4136b4a597, 0x31680a88f8953031,
+    0xabcc77118461cefc, 0xfdc20d2b36ba7c3e,
+    0xd6bf94d5e57a42bc, 0x3d32907604691b4d,
+    0x8637bd05af6c69b5, 0xa63f9a49c2c1b110,
+    0xa7c5ac471b478423, 0x0fcf80dc33721d54,
+    0xd1b71758e219652b, 0xd3c36113404ea4a9,
+    0x83126e978d4fdf3b, 0x645a1cac083126ea,
+    0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4,
+    0xcccccccccccccccc, 0xcccccccccccccccd,
+    0x8000000000000000, 0x0000000000000000,
+    0xa000000000000000, 0x0000000000000000,
+    0xc800000000000000, 0x0000000000000000,
+    0xfa00000000000000, 0x0000000000000000,
+    0x9c40000000000000, 0x0000000000000000,
+    0xc350000000000000, 0x0000000000000000,
+    0xf424000000000000, 0x0000000000000000,
+    0x9896800000000000, 0x0000000000000000,
+    0xbebc200000000000, 0x0000000000000000,
+    0xee6b280000000000, 0x0000000000000000,
+    0x9502f90000000000, 0x0000000000000000,
+    0xba43b74000000000, 0x0000000000000000,
+    0xe8d4a51000000000, 0x0000000000000000,
+    0x9184e72a00000000, 0x0000000000000000,
+    0xb5e620f480000000, 0x0000000000000000,
+    0xe35fa931a0000000, 0x0000000000000000,
+    0x8e1bc9bf04000000, 0x0000000000000000,
+    0xb1a2bc2ec5000000, 0x0000000000000000,
+    0xde0b6b3a76400000, 0x0000000000000000,
+    0x8ac7230489e80000, 0x0000000000000000,
+    0xad78ebc5ac620000, 0x0000000000000000,
+    0xd8d726b7177a8000, 0x0000000000000000,
+    0x878678326eac9000, 0x0000000000000000,
+    0xa968163f0a57b400, 0x0000000000000000,
+    0xd3c21bcecceda100, 0x0000000000000000,
+    0x84595161401484a0, 0x0000000000000000,
+    0xa56fa5b99019a5c8, 0x0000000000000000,
+    0xcecb8f27f4200f3a, 0x0000000000000000,
+    0x813f3978f8940984, 0x4000000000000000,
+    0xa18f07d736b90be5, 0x5000000000000000,
+    0xc9f2c9cd04674ede, 0xa400000000000000,
+    0xfc6f7c4045812296, 0x4d00000000000000,
+    0x9dc5ada82b70b59d, 0xf020000000000000,
+    0xc5371912364ce305, 0x6c28000000000000,
+    0xf684df56c3e01bc6, 0xc732000000000000,
+    0x9a130b963a6c115c, 0x3c7f400000000000,
+    0xc097ce7bc90715b3, 0x4b9f100000000000,
+    0xf0bdc21abb48db20, 0x1e86d40000000000,
+    0x96769950b50d88f4, 0x1314448000000000,
+    0xbc143fa4e250eb31, 0x17d955a000000000,
+    0xeb194f8e1ae525fd, 0x5dcfab0800000000,
+    0x92efd1b8d0cf37be, 0x5aa1cae500000000,
+    0xb7abc627050305ad, 0xf14a3d9e40000000,
+    0xe596b7b0c643c719, 0x6d9ccd05d0000000,
+    0x8f7e32ce7bea5c6f, 0xe4820023a2000000,
+    0xb35dbf821ae4f38b, 0xdda2802c8a800000,
+    0xe0352f62a19e306e, 0xd50b2037ad200000,
+    0x8c213d9da502de45, 0x4526f422cc340000,
+    0xaf298d050e4395d6, 0x9670b12b7f410000,
+    0xdaf3f04651d47b4c, 0x3c0cdd765f114000,
+    0x88d8762bf324cd0f, 0xa5880a69fb6ac800,
+    0xab0e93b6efee0053, 0x8eea0d047a457a00,
+    0xd5d238a4abe98068, 0x72a4904598d6d880,
+    0x85a36366eb71f041, 0x47a6da2b7f864750,
+    0xa70c3c40a64e6c51, 0x999090b65f67d924,
+    0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d,
+    0x82818f1281ed449f, 0xbff8f10e7a8921a5,
+    0xa321f2d7226895c7, 0xaff72d52192b6a0e,
+    0xcbea6f8ceb02bb39, 0x9bf4f8a69f764491,
+    0xfee50b7025c36a08, 0x02f236d04753d5b5,
+    0x9f4f2726179a2245, 0x01d762422c946591,
+    0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef6,
+    0xf8ebad2b84e0d58b, 0xd2e0898765a7deb3,
+    0x9b934c3b330c8577, 0x63cc55f49f88eb30,
+    0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fc,
+    0xf316271c7fc3908a, 0x8bef464e3945ef7b,
+    0x97edd871cfda3a56, 0x97758bf0e3cbb5ad,
+    0xbde94e8e43d0c8ec, 0x3d52eeed1cbea318,
+    0xed63a231d4c4fb27, 0x4ca7aaa863ee4bde,
+    0x945e455f24fb1cf8, 0x8fe8caa93e74ef6b,
+    0xb975d6b6ee39e436, 0xb3e2fd538e122b45,
+    0xe7d34c64a9c85d44, 0x60dbbca87196b617,
+    0x90e40fbeea1d3a4a, 0xbc8955e946fe31ce,
+    0xb51d13aea4a488dd, 0x6babab6398bdbe42,
+    0xe264589a4dcdab14, 0xc696963c7eed2dd2,
+    0x8d7eb76070a08aec, 0xfc1e1de5cf543ca3,
+    0xb0de65388cc8ada8, 0x3b25a55f43294bcc,
+    0xdd15fe86affad912, 0x49ef0eb713f39ebf,
+    0x8a2dbf142dfcc7ab, 0x6e3569326c784338,
+    0xacb92ed9397bf996, 0x49c2c37f07965405,
+    0xd7e77a8f87daf7fb, 0xdc33745ec97be907,
+    0x86f0ac99b4e8dafd, 0x69a028bb3ded71a4,
+    0xa8acd7c0222311bc, 0xc40832ea0d68ce0d,
+    0xd2d80db02aabd62b, 0xf50a3fa490c30191,
+    0x83c7088e1aab65db, 0x792667c6da79e0fb,
+    0xa4b8cab1a1563f52, 0x577001b891185939,
+    0xcde6fd5e09abcf26, 0xed4c0226b55e6f87,
+    0x80b05e5ac60b6178, 0x544f8158315b05b5,
+    0xa0dc75f1778e39d6, 0x696361ae3db1c722,
+    0xc913936dd571c84c, 0x03bc3a19cd1e38ea,
+    0xfb5878494ace3a5f, 0x04ab48a04065c724,
+    0x9d174b2dcec0e47b, 0x62eb0d64283f9c77,
+    0xc45d1df942711d9a, 0x3ba5d0bd324f8395,
+    0xf5746577930d6500, 0xca8f44ec7ee3647a,
+    0x9968bf6abbe85f20, 0x7e998b13cf4e1ecc,
+    0xbfc2ef456ae276e8, 0x9e3fedd8c321a67f,
+    0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101f,
+    0x95d04aee3b80ece5, 0xbba1f1d158724a13,
+    0xbb445da9ca61281f, 0x2a8a6e45ae8edc98,
+    0xea1575143cf97226, 0xf52d09d71a3293be,
+    0x924d692ca61be758, 0x593c2626705f9c57,
+    0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836d,
+    0xe498f455c38b997a, 0x0b6dfb9c0f956448,
+    0x8edf98b59a373fec, 0x4724bd4189bd5ead,
+    0xb2977ee300c50fe7, 0x58edec91ec2cb658,
+    0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ee,
+    0x8b865b215899f46c, 0xbd79e0d20082ee75,
+    0xae67f1e9aec07187, 0xecd8590680a3aa12,
+    0xda01ee641a708de9, 0xe80e6f4820cc9496,
+    0x884134fe908658b2, 0x3109058d147fdcde,
+    0xaa51823e34a7eede, 0xbd4b46f0599fd416,
+    0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91b,
+    0x850fadc09923329e, 0x03e2cf6bc604ddb1,
+    0xa6539930bf6bff45, 0x84db8346b786151d,
+    0xcfe87f7cef46ff16, 0xe612641865679a64,
+    0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07f,
+    0xa26da3999aef7749, 0xe3be5e330f38f09e,
+    0xcb090c8001ab551c, 0x5cadf5bfd3072cc6,
+    0xfdcb4fa002162a63, 0x73d9732fc7c8f7f7,
+    0x9e9f11c4014dda7e, 0x2867e7fddcdd9afb,
+    0xc646d63501a1511d, 0xb281e1fd541501b9,
+    0xf7d88bc24209a565, 0x1f225a7ca91a4227,
+    0x9ae757596946075f, 0x3375788de9b06959,
+    0xc1a12d2fc3978937, 0x0052d6b1641c83af,
+    0xf209787bb47d6b84, 0xc0678c5dbd23a49b,
+    0x9745eb4d50ce6332, 0xf840b7ba963646e1,
+    0xbd176620a501fbff, 0xb650e5a93bc3d899,
+    0xec5d3fa8ce427aff, 0xa3e51f138ab4cebf,
+    0x93ba47c980e98cdf, 0xc66f336c36b10138,
+    0xb8a8d9bbe123f017, 0xb80b0047445d4185,
+    0xe6d3102ad96cec1d, 0xa60dc059157491e6,
+    0x9043ea1ac7e41392, 0x87c89837ad68db30,
+    0xb454e4a179dd1877, 0x29babe4598c311fc,
+    0xe16a1dc9d8545e94, 0xf4296dd6fef3d67b,
+    0x8ce2529e2734bb1d, 0x1899e4a65f58660d,
+    0xb01ae745b101e9e4, 0x5ec05dcff72e7f90,
+    0xdc21a1171d42645d, 0x76707543f4fa1f74,
+    0x899504ae72497eba, 0x6a06494a791c53a9,
+    0xabfa45da0edbde69, 0x0487db9d17636893,
+    0xd6f8d7509292d603, 0x45a9d2845d3c42b7,
+    0x865b86925b9bc5c2, 0x0b8a2392ba45a9b3,
+    0xa7f26836f282b732, 0x8e6cac7768d7141f,
+    0xd1ef0244af2364ff, 0x3207d795430cd927,
+    0x8335616aed761f1f, 0x7f44e6bd49e807b9,
+    0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a7,
+    0xcd036837130890a1, 0x36dba887c37a8c10,
+    0x802221226be55a64, 0xc2494954da2c978a,
+    0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6d,
+    0xc83553c5c8965d3d, 0x6f92829494e5acc8,
+    0xfa42a8b73abbf48c, 0xcb772339ba1f17fa,
+    0x9c69a97284b578d7, 0xff2a760414536efc,
+    0xc38413cf25e2d70d, 0xfef5138519684abb,
+    0xf46518c2ef5b8cd1, 0x7eb258665fc25d6a,
+    0x98bf2f79d5993802, 0xef2f773ffbd97a62,
+    0xbeeefb584aff8603, 0xaafb550ffacfd8fb,
+    0xeeaaba2e5dbf6784, 0x95ba2a53f983cf39,
+    0x952ab45cfa97a0b2, 0xdd945a747bf26184,
+    0xba756174393d88df, 0x94f971119aeef9e5,
+    0xe912b9d1478ceb17, 0x7a37cd5601aab85e,
+    0x91abb422ccb812ee, 0xac62e055c10ab33b,
+    0xb616a12b7fe617aa, 0x577b986b314d600a,
+    0xe39c49765fdf9d94, 0xed5a7e85fda0b80c,
+    0x8e41ade9fbebc27d, 0x14588f13be847308,
+    0xb1d219647ae6b31c, 0x596eb2d8ae258fc9,
+    0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bc,
+    0x8aec23d680043bee, 0x25de7bb9480d5855,
+    0xada72ccc20054ae9, 0xaf561aa79a10ae6b,
+    0xd910f7ff28069da4, 0x1b2ba1518094da05,
+    0x87aa9aff79042286, 0x90fb44d2f05d0843,
+    0xa99541bf57452b28, 0x353a1607ac744a54,
+    0xd3fa922f2d1675f2, 0x42889b8997915ce9,
+    0x847c9b5d7c2e09b7, 0x69956135febada12,
+    0xa59bc234db398c25, 0x43fab9837e699096,
+    0xcf02b2c21207ef2e, 0x94f967e45e03f4bc,
+    0x8161afb94b44f57d, 0x1d1be0eebac278f6,
+    0xa1ba1ba79e1632dc, 0x6462d92a69731733,
+    0xca28a291859bbf93, 0x7d7b8f7503cfdcff,
+    0xfcb2cb35e702af78, 0x5cda735244c3d43f,
+    0x9defbf01b061adab, 0x3a0888136afa64a8,
+    0xc56baec21c7a1916, 0x088aaa1845b8fdd1,
+    0xf6c69a72a3989f5b, 0x8aad549e57273d46,
+    0x9a3c2087a63f6399, 0x36ac54e2f678864c,
+    0xc0cb28a98fcf3c7f, 0x84576a1bb416a7de,
+    0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d6,
+    0x969eb7c47859e743, 0x9f644ae5a4b1b326,
+    0xbc4665b596706114, 0x873d5d9f0dde1fef,
+    0xeb57ff22fc0c7959, 0xa90cb506d155a7eb,
+    0x9316ff75dd87cbd8, 0x09a7f12442d588f3,
+    0xb7dcbf5354e9bece, 0x0c11ed6d538aeb30,
+    0xe5d3ef282a242e81, 0x8f1668c8a86da5fb,
+    0x8fa475791a569d10, 0xf96e017d694487bd,
+    0xb38d92d760ec4455, 0x37c981dcc395a9ad,
+    0xe070f78d3927556a, 0x85bbe253f47b1418,
+    0x8c469ab843b89562, 0x93956d7478ccec8f,
+    0xaf58416654a6babb, 0x387ac8d1970027b3,
+    0xdb2e51bfe9d0696a, 0x06997b05fcc0319f,
+    0x88fcf317f22241e2, 0x441fece3bdf81f04,
+    0xab3c2fddeeaad25a, 0xd527e81cad7626c4,
+    0xd60b3bd56a5586f1, 0x8a71e223d8d3b075,
+    0x85c7056562757456, 0xf6872d5667844e4a,
+    0xa738c6bebb12d16c, 0xb428f8ac016561dc,
+    0xd106f86e69d785c7, 0xe13336d701beba53,
+    0x82a45b450226b39c, 0xecc0024661173474,
+    0xa34d721642b06084, 0x27f002d7f95d0191,
+    0xcc20ce9bd35c78a5, 0x31ec038df7b441f5,
+    0xff290242c83396ce, 0x7e67047175a15272,
+    0x9f79a169bd203e41, 0x0f0062c6e984d387,
+    0xc75809c42c684dd1, 0x52c07b78a3e60869,
+    0xf92e0c3537826145, 0xa7709a56ccdf8a83,
+    0x9bbcc7a142b17ccb, 0x88a66076400bb692,
+    0xc2abf989935ddbfe, 0x6acff893d00ea436,
+    0xf356f7ebf83552fe, 0x0583f6b8c4124d44,
+    0x98165af37b2153de, 0xc3727a337a8b704b,
+    0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5d,
+    0xeda2ee1c7064130c, 0x1162def06f79df74,
+    0x9485d4d1c63e8be7, 0x8addcb5645ac2ba9,
+    0xb9a74a0637ce2ee1, 0x6d953e2bd7173693,
+    0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0438,
+    0x910ab1d4db9914a0, 0x1d9c9892400a22a3,
+    0xb54d5e4a127f59c8, 0x2503beb6d00cab4c,
+    0xe2a0b5dc971f303a, 0x2e44ae64840fd61e,
+    0x8da471a9de737e24, 0x5ceaecfed289e5d3,
+    0xb10d8e1456105dad, 0x7425a83e872c5f48,
+    0xdd50f1996b947518, 0xd12f124e28f7771a,
+    0x8a5296ffe33cc92f, 0x82bd6b70d99aaa70,
+    0xace73cbfdc0bfb7b, 0x636cc64d1001550c,
+    0xd8210befd30efa5a, 0x3c47f7e05401aa4f,
+    0x8714a775e3e95c78, 0x65acfaec34810a72,
+    0xa8d9d1535ce3b396, 0x7f1839a741a14d0e,
+    0xd31045a8341ca07c, 0x1ede48111209a051,
+    0x83ea2b892091e44d, 0x934aed0aab460433,
+    0xa4e4b66b68b65d60, 0xf81da84d56178540,
+    0xce1de40642e3f4b9, 0x36251260ab9d668f,
+    0x80d2ae83e9ce78f3, 0xc1d72b7c6b42601a,
+    0xa1075a24e4421730, 0xb24cf65b8612f820,
+    0xc94930ae1d529cfc, 0xdee033f26797b628,
+    0xfb9b7cd9a4a7443c, 0x169840ef017da3b2,
+    0x9d412e0806e88aa5, 0x8e1f289560ee864f,
+    0xc491798a08a2ad4e, 0xf1a6f2bab92a27e3,
+    0xf5b5d7ec8acb58a2, 0xae10af696774b1dc,
+    0x9991a6f3d6bf1765, 0xacca6da1e0a8ef2a,
+    0xbff610b0cc6edd3f, 0x17fd090a58d32af4,
+    0xeff394dcff8a948e, 0xddfc4b4cef07f5b1,
+    0x95f83d0a1fb69cd9, 0x4abdaf101564f98f,
+    0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f2,
+    0xea53df5fd18d5513, 0x84c86189216dc5ee,
+    0x92746b9be2f8552c, 0x32fd3cf5b4e49bb5,
+    0xb7118682dbb66a77, 0x3fbc8c33221dc2a2,
+    0xe4d5e82392a40515, 0x0fabaf3feaa5334b,
+    0x8f05b1163ba6832d, 0x29cb4d87f2a7400f,
+    0xb2c71d5bca9023f8, 0x743e20e9ef511013,
+    0xdf78e4b2bd342cf6, 0x914da9246b255417,
+    0x8bab8eefb6409c1a, 0x1ad089b6c2f7548f,
+    0xae9672aba3d0c320, 0xa184ac2473b529b2,
+    0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741f,
+    0x8865899617fb1871, 0x7e2fa67c7a658893,
+    0xaa7eebfb9df9de8d, 0xddbb901b98feeab8,
+    0xd51ea6fa85785631, 0x552a74227f3ea566,
+    0x8533285c936b35de, 0xd53a88958f872760,
+    0xa67ff273b8460356, 0x8a892abaf368f138,
+    0xd01fef10a657842c, 0x2d2b7569b0432d86,
+    0x8213f56a67f6b29b, 0x9c3b29620e29fc74,
+    0xa298f2c501f45f42, 0x8349f3ba91b47b90,
+    0xcb3f2f7642717713, 0x241c70a936219a74,
+    0xfe0efb53d30dd4d7, 0xed238cd383aa0111,
+    0x9ec95d1463e8a506, 0xf4363804324a40ab,
+    0xc67bb4597ce2ce48, 0xb143c6053edcd0d6,
+    0xf81aa16fdc1b81da, 0xdd94b7868e94050b,
+    0x9b10a4e5e9913128, 0xca7cf2b4191c8327,
+    0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f1,
+    0xf24a01a73cf2dccf, 0xbc633b39673c8ced,
+    0x976e41088617ca01, 0xd5be0503e085d814,
+    0xbd49d14aa79dbc82, 0x4b2d8644d8a74e19,
+    0xec9c459d51852ba2, 0xddf8e7d60ed1219f,
+    0x93e1ab8252f33b45, 0xcabb90e5c942b504,
+    0xb8da1662e7b00a17, 0x3d6a751f3b936244,
+    0xe7109bfba19c0c9d, 0x0cc512670a783ad5,
+    0x906a617d450187e2, 0x27fb2b80668b24c6,
+    0xb484f9dc9641e9da, 0xb1f9f660802dedf7,
+    0xe1a63853bbd26451, 0x5e7873f8a0396974,
+    0x8d07e33455637eb2, 0xdb0b487b6423e1e9,
+    0xb049dc016abc5e5f, 0x91ce1a9a3d2cda63,
+    0xdc5c5301c56b75f7, 0x7641a140cc7810fc,
+    0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9e,
+    0xac2820d9623bf429, 0x546345fa9fbdcd45,
+    0xd732290fbacaf133, 0xa97c177947ad4096,
+    0x867f59a9d4bed6c0, 0x49ed8eabcccc485e,
+    0xa81f301449ee8c70, 0x5c68f256bfff5a75,
+    0xd226fc195c6a2f8c, 0x73832eec6fff3112,
+    0x83585d8fd9c25db7, 0xc831fd53c5ff7eac,
+    0xa42e74f3d032f525, 0xba3e7ca8b77f5e56,
+    0xcd3a1230c43fb26f, 0x28ce1bd2e55f35ec,
+    0x80444b5e7aa7cf85, 0x7980d163cf5b81b4,
+    0xa0555e361951c366, 0xd7e105bcc3326220,
+    0xc86ab5c39fa63440, 0x8dd9472bf3fefaa8,
+    0xfa856334878fc150, 0xb14f98f6f0feb952,
+    0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d4,
+    0xc3b8358109e84f07, 0x0a862f80ec4700c9,
+    0xf4a642e14c6262c8, 0xcd27bb612758c0fb,
+    0x98e7e9cccfbd7dbd, 0x8038d51cb897789d,
+    0xbf21e44003acdd2c, 0xe0470a63e6bd56c4,
+    0xeeea5d5004981478, 0x1858ccfce06cac75,
+    0x95527a5202df0ccb, 0x0f37801e0c43ebc9,
+    0xbaa718e68396cffd, 0xd30560258f54e6bb,
+    0xe950df20247c83fd, 0x47c6b82ef32a206a,
+    0x91d28b7416cdd27e, 0x4cdc331d57fa5442,
+    0xb6472e511c81471d, 0xe0133fe4adf8e953,
+    0xe3d8f9e563a198e5, 0x58180fddd97723a7,
+    0x8e679c2f5e44ff8f, 0x570f09eaa7ea7649,
+    0xb201833b35d63f73, 0x2cd2cc6551e513db,
+    0xde81e40a034bcf4f, 0xf8077f7ea65e58d2,
+    0x8b112e86420f6191, 0xfb04afaf27faf783,
+    0xadd57a27d29339f6, 0x79c5db9af1f9b564,
+    0xd94ad8b1c7380874, 0x18375281ae7822bd,
+    0x87cec76f1c830548, 0x8f2293910d0b15b6,
+    0xa9c2794ae3a3c69a, 0xb2eb3875504ddb23,
+    0xd433179d9c8cb841, 0x5fa60692a46151ec,
+    0x849feec281d7f328, 0xdbc7c41ba6bcd334,
+    0xa5c7ea73224deff3, 0x12b9b522906c0801,
+    0xcf39e50feae16bef, 0xd768226b34870a01,
+    0x81842f29f2cce375, 0xe6a1158300d46641,
+    0xa1e53af46f801c53, 0x60495ae3c1097fd1,
+    0xca5e89b18b602368, 0x385bb19cb14bdfc5,
+    0xfcf62c1dee382c42, 0x46729e03dd9ed7b6,
+    0x9e19db92b4e31ba9, 0x6c07a2c26a8346d2,
+    0xc5a05277621be293, 0xc7098b7305241886,
+    0xf70867153aa2db38, 0xb8cbee4fc66d1ea8,
+};
 
-// double->str
-u32 ekonDoubleToStr(f64 n, char *buff) {
-  return snprintf(buff, 32, "%.17g", n);
+// round g * cp / 2^128 to odd, g being 128 bits of ekonPow10Up
+u64 ekonRoundToOdd(const u64 *g, u64 cp) {
+  u64 xHigh, yHigh;
+  ekonMul128(g[1], cp, &xHigh);
+  const u64 yLow = ekonMul128(g[0], cp, &yHigh);
+  const u64 zLow = yLow + xHigh;
+  const u64 zHigh = yHigh + (zLow < yLow);
+  return zHigh | (zLow > 1);
 }
 
-void ekonUpdateErrorVars(const char *s, const u32 index, u32 *pos, u32 *line) {
-  u32 cursor = 0;
-  while (s[cursor] != 0 && cursor != index) {
-    if (s[cursor] == '\n') {
-      *pos = 0;
-      (*line)++;
+/**
+ * @brief shortest decimal that reads back as d (Schubfach, Giulietti 2020).
+ *        d = outDigits * 10^outExp
+ * @param d         finite, positive double
+ * @param outDigits significand without trailing zeros
+ * @param outExp    decimal exponent
+ * */
+void ekonDoubleShortest(f64 d, u64 *outDigits, i32 *outExp) {
+  u64 bits;
+  memcpy(&bits, &d, sizeof(bits));
+  const u64 ieeeSignificand = bits & (((u64)1 << 52) - 1);
+  const u32 ieeeExponent = (u32)(bits >> 52) & 0x7FF;
+
+  u64 c;
+  i32 q;
+  u64 digits;
+  i32 exp10;
+  if (ieeeExponent != 0) {
+    c = ((u64)1 << 52) | ieeeSignificand;
+    q = (i32)ieeeExponent - 1075;
+  } else {
+    c = ieeeSignificand;
+    q = -1074;
+  }
+
+  if (q <= 0 && q > -53 && (c & (((u64)1 << -q) - 1)) == 0) {
+    // an integer below 2^53
+    digits = c >> -q;
+    exp10 = 0;
+  } else {
+    const bool isEven = (c & 1) == 0;
+    const bool lowerIsCloser = ieeeSignificand == 0 && ieeeExponent > 1;
+    const u64 cbl = 4 * c - 2 + lowerIsCloser;
+    const u64 cb = 4 * c;
+    const u64 cbr = 4 * c + 2;
+
+    // floor(log10(2^q)), or floor(log10(3/4 * 2^q)) if the lower neighbor
+    // is closer. then h = q + floor(log2(10^-k)) + 1, in [1, 4]
+    const i32 k = (q * 1262611 - (lowerIsCloser ? 524031 : 0)) >> 22;
+    const i32 h = q + ((-k * 1741647) >> 19) + 1;
+    const u64 *g = ekonPow10Up + 2 * (-k - EKON_POW10_UP_MIN);
+    const u64 vbl = ekonRoundToOdd(g, cbl << h);
+    const u64 vb = ekonRoundToOdd(g, cb << h);
+    const u64 vbr = ekonRoundToOdd(g, cbr << h);
+    const u64 lower = vbl + !isEven;
+    const u64 upper = vbr - !isEven;
+
+    // one digit less if that is still inside the rounding interval
+    const u64 s = vb / 4;
+    exp10 = k;
+    if (s >= 10) {
+      const u64 sp = s / 10;
+      const bool upInside = lower <= 40 * sp;
+      const bool wpInside = 40 * sp + 40 <= upper;
+      if (upInside != wpInside) {
+        digits = sp + wpInside;
+        exp10 = k + 1;
+        goto trim;
+      }
+    }
+    const bool uInside = lower <= 4 * s;
+    const bool wInside = 4 * s + 4 <= upper;
+    if (uInside != wInside) {
+      digits = s + wInside;
+    } else {
+      const u64 mid = 4 * s + 2;
+      digits = s + (vb > mid || (vb == mid && (s & 1) != 0));
+    }
+  }
+
+trim:
+  while (digits % 10 == 0) {
+    digits /= 10;
+    exp10++;
+  }
+  *outDigits = digits;
+  *outExp = exp10;
+}
+
+/**
+ * @brief double->str, the shortest digits that read back as n. plain
+ *        notation like %g (1e-4 <= |n| < 1e17), otherwise `1.5e-7`. nan and
+ *        inf are written as `nan`, `inf` and `-inf`
+ * @param n     number
+ * @param buff  at least 32 bytes
+ * @return      length, without the '\0' that follows
+ * */
+u32 ekonDoubleToStr(f64 n, char *buff) {
+  char *p = buff;
+  u64 bits;
+  memcpy(&bits, &n, sizeof(bits));
+  if (((bits >> 52) & 0x7FF) == 0x7FF) {
+    if ((bits & (((u64)1 << 52) - 1)) != 0)
+      return (u32)(memcpy(buff, "nan", 4), 3);
+    if (bits >> 63)
+      *p++ = '-';
+    memcpy(p, "inf", 4);
+    return (u32)(p - buff) + 3;
+  }
+  if (bits >> 63) {
+    *p++ = '-';
+    n = -n;
+  }
+  if (n == 0) {
+    memcpy(p, "0", 2);
+    return (u32)(p - buff) + 1;
+  }
+
+  u64 digits;
+  i32 exp10;
+  ekonDoubleShortest(n, &digits, &exp10);
+  char d[21];
+  const i32 nd = (i32)ekonU64ToStr(digits, d);
+  // the decimal point comes after `point` digits
+  const i32 point = nd + exp10;
+
+  if (point > -4 && point <= 17) {
+    if (exp10 >= 0) {
+      memcpy(p, d, nd);
+      memset(p + nd, '0', exp10);
+      p += point;
+    } else if (point > 0) {
+      memcpy(p, d, point);
+      p[point] = '.';
+      memcpy(p + point + 1, d + point, nd - point);
+      p += nd + 1;
+    } else {
+      memcpy(p, "0.", 2);
+      memset(p + 2, '0', -point);
+      memcpy(p + 2 - point, d, nd);
+      p += 2 - point + nd;
+    }
+  } else {
+    *p++ = d[0];
+    if (nd > 1) {
+      *p++ = '.';
+      memcpy(p, d + 1, nd - 1);
+      p += nd - 1;
+    }
+    *p++ = 'e';
+    p += ekonI64ToStr(point - 1, p);
+  }
+  *p = 0;
+  return (u32)(p - buff);
+}
+
+void ekonUpdateErrorVars(const char *s, const u32 len, const u32 index,
+                         u32 *pos, u32 *line) {
+  u32 cursor = 0;
+  while (cursor < len && s[cursor] != 0 && cursor != index) {
+    if (s[cursor] == '\n') {
+      *pos = 0;
+      (*line)++;
     }
     (*pos)++;
     cursor++;
@@ -779,43 +2930,61 @@ void ekonUpdateErrorVars(const char *s, const u32 index, u32 *pos, u32 *line) {
   (*pos)--;
 }
 
-bool ekonParseError(char **outMessage, const char *s, const u32 index) {
+/**
+ * @brief ekonParseError for a source of `len` bytes that need not end in '\0'
+ * @param outMessage  pointer to the character array
+ * @param s           start of the source
+ * @param len         length of the source
+ * @param index       index in `s` where the error occured
+ * @return false
+ * */
+bool ekonParseErrorLen(char **outMessage, const char *s, const u32 len,
+                       const u32 index) {
+  if (outMessage == NULL)
+    return false;
   u32 pos = 1, line = 1, cursor = 0;
-  ekonUpdateErrorVars(s, index, &pos, &line);
+  ekonUpdateErrorVars(s, len, index, &pos, &line);
 
   // allocate memory for the message
-  *outMessage = (char *)malloc(sizeof(char) * 50);
+  *outMessage = (char *)ekonNew(sizeof(char) * 50);
 
   // error messages will be of format: "<line>:<pos>:<character>" with `:` as
-  if (s[index] == 0)
+  if (ekonCharAt(s, len, index) == 0)
     snprintf(*outMessage, 50, "%d:%d:0", line, pos);
   else
-    snprintf(*outMessage, 50, "%d:%d:%c", line, pos, s[index - 1]);
+    snprintf(*outMessage, 50, "%d:%d:%c", line, pos,
+             s[index > 0 ? index - 1 : 0]);
 
   return false;
 }
 
+bool ekonParseError(char **outMessage, const char *s, const u32 index) {
+  return ekonParseErrorLen(outMessage, s, ekonStrLen(s), index);
+}
+
 bool ekonDuplicateKeyError(char **outMessage, const char *s, const u32 index,
                            const u32 keyLen) {
+  if (outMessage == NULL)
+    return false;
   u32 pos = 1, line = 1, cursor = 0;
-  ekonUpdateErrorVars(s, index, &pos, &line);
+  ekonUpdateErrorVars(s, index, index, &pos, &line);
 
-  *outMessage = (char *)malloc(sizeof(char) * (100 + keyLen));
-  char *key = (char *)malloc((sizeof(char) * (keyLen + 1)));
-  ekonCopy(s + index, keyLen, key);
-  key[index] = '\0';
+  *outMessage = (char *)ekonNew(sizeof(char) * (100 + keyLen));
 
   // <line>:<pos>:<key>:<message>
-  snprintf(*outMessage, 100, "%d:%d:%s:Duplicate Key", line, pos, key);
+  snprintf(*outMessage, 100 + keyLen, "%d:%d:%.*s:Duplicate Key", line, pos,
+           (int)keyLen, s + index);
   return false;
 }
 
 bool ekonEmptyKeyError(char **outMessage, const char *s, const u32 index) {
+  if (outMessage == NULL)
+    return false;
   u32 pos = 1, line = 1, cursor = 0;
-  ekonUpdateErrorVars(s, index, &pos, &line);
+  ekonUpdateErrorVars(s, index, index, &pos, &line);
 
   // <line>:<pos>:<message>
-  *outMessage = (char *)malloc(sizeof(char) * 100);
+  *outMessage = (char *)ekonNew(sizeof(char) * 100);
   snprintf(*outMessage, 100, "%d:%d:Empty Key", line, pos);
   return false;
 }
@@ -855,6 +3024,8 @@ EkonAllocator *ekonAllocatorNew() {
   alloc->root->data = (char *)ptr + sizeof(EkonAllocator) + sizeof(EkonANode);
   alloc->root->pos = 0;
   alloc->root->next = 0;
+  alloc->keys = 0;
+  alloc->scratch = 0;
   return alloc;
 }
 
@@ -883,7 +3054,7 @@ bool ekonAllocatorAppendChild(u32 init_size, EkonAllocator *alloc) {
   node->size = init_size;
   node->data = (char *)ptr + sizeof(EkonANode);
   node->pos = 0;
-  node->next = 0;
+  node->next = alloc->end->next; // blocks kept by ekonAllocatorReset
   alloc->end->next = node;
   alloc->end = node;
   return true;
@@ -893,11 +3064,16 @@ char *ekonAllocatorAlloc(EkonAllocator *alloc, u32 size) {
   EkonANode *currNode = alloc->end;
   u32 s = currNode->size;
   if (EKON_UNLIKELY(currNode->pos + size > s)) {
-    s *= ekonDelta;
-    while (EKON_UNLIKELY(size > s))
+    // after a reset, the blocks kept follow the one in use
+    if (currNode->next != 0 && size <= currNode->next->size) {
+      alloc->end = currNode->next;
+    } else {
       s *= ekonDelta;
-    if (EKON_UNLIKELY(ekonAllocatorAppendChild(s, alloc) == false))
-      return 0;
+      while (EKON_UNLIKELY(size > s))
+        s *= ekonDelta;
+      if (EKON_UNLIKELY(ekonAllocatorAppendChild(s, alloc) == false))
+        return 0;
+    }
     currNode = alloc->end;
   }
   char *ret = currNode->data + currNode->pos;
@@ -905,10 +3081,75 @@ char *ekonAllocatorAlloc(EkonAllocator *alloc, u32 size) {
   return ret;
 }
 
-// consume a comment. both rangin multiple lines and single lines
-bool ekonConsumeComment(const char *s, u32 *index);
+void ekonAllocatorReset(EkonAllocator *alloc, EkonResetPolicy policy) {
+  EkonANode *n;
+  if (policy != EKON_RESET_KEEP_ALL) {
+    // blocks joined from the slices of a parallel parse are not in order of
+    // size, so the largest is looked for
+    EkonANode *largest = 0;
+    if (policy == EKON_RESET_KEEP_LARGEST)
+      for (n = alloc->root->next; n != 0; n = n->next)
+        if (largest == 0 || n->size > largest->size)
+          largest = n;
+    n = alloc->root->next;
+    while (n != 0) {
+      EkonANode *nn = n->next;
+      if (n != largest)
+        ekonFree((void *)n);
+      n = nn;
+    }
+    alloc->root->next = largest;
+    if (largest != 0)
+      largest->next = 0;
+  }
+  for (n = alloc->root; n != 0; n = n->next)
+    n->pos = 0;
+  alloc->end = alloc->root;
+  alloc->scratch = 0;
+}
+
+/**
+ * @brief set up an allocator in place. unlike ekonAllocatorNew, every block
+ *        of it is a malloc of its own, so they can all be handed over to
+ *        another allocator with ekonAllocatorJoin
+ * @param alloc     allocator to set up
+ * @param initSize  size of the first block
+ * @return          false if out of memory
+ * */
+bool ekonAllocatorInit(EkonAllocator *alloc, u32 initSize) {
+  EkonANode *node = (EkonANode *)ekonNew(sizeof(EkonANode) + initSize);
+  if (EKON_UNLIKELY(node == 0))
+    return false;
+  node->size = initSize;
+  node->data = (char *)node + sizeof(EkonANode);
+  node->pos = 0;
+  node->next = 0;
+  alloc->root = alloc->end = node;
+  alloc->keys = 0;
+  alloc->scratch = 0;
+  return true;
+}
+
+// move the blocks of `from` (see ekonAllocatorInit) to the end of `alloc`.
+// they are released with it
+void ekonAllocatorJoin(EkonAllocator *alloc, EkonAllocator *from) {
+  from->end->next = alloc->end->next;
+  alloc->end->next = from->root;
+  alloc->end = from->end;
+}
+
+// release the blocks of an allocator set up by ekonAllocatorInit
+void ekonAllocatorDrop(EkonAllocator *alloc) {
+  EkonANode *next = alloc->root;
+  while (next != 0) {
+    EkonANode *nn = next->next;
+    ekonFree((void *)next);
+    next = nn;
+  }
+}
 
-static EkonString *ekonStringCache = 0;
+// consume a comment. both rangin multiple lines and single lines
+bool ekonConsumeComment(const char *s, const u32 len, u32 *index);
 
 // get a new string object
 EkonString *ekonStringNew(EkonAllocator *alloc, u32 initSize) {
@@ -1196,51 +3437,480 @@ EkonValue *ekonValueInnerNew(EkonAllocator *alloc, EkonNode *n) {
   return v;
 }
 
+// count trailing zeros. x must not be 0
+u32 ekonCtz64(u64 x) {
+#if defined(_MSC_VER)
+  unsigned long r;
+  _BitScanForward64(&r, x);
+  return (u32)r;
+#else
+  return (u32)__builtin_ctzll(x);
+#endif
+}
+
+#if defined(EKON_SIMD_SSE2)
+// whitespace mask of the 16 bytes at the aligned address p
+u32 ekonWhiteMask16(const char *p) {
+  const __m128i in = _mm_load_si128((const __m128i *)p);
+  const __m128i ws = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(' ')),
+                   _mm_cmpeq_epi8(in, _mm_set1_epi8('\n'))),
+      _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('\t')),
+                   _mm_cmpeq_epi8(in, _mm_set1_epi8('\r'))));
+  return (u32)_mm_movemask_epi8(ws);
+}
+#endif
+
 /*
  * @brief check if a character is a whitespace ('\r', '\t', '\n', ' ')
  * @param c character to be checked
  * @return true/false
  * */
 bool ekonSkin(const char c) {
-  return EKON_UNLIKELY(
-      EKON_UNLIKELY(c == ' ') ||
-      EKON_UNLIKELY(c == '\t' ||
-                    EKON_UNLIKELY(c == '\n' || EKON_UNLIKELY(c == '\r'))));
+  return (ekonClass(c) & EKON_CHAR_WHITE) != 0;
+}
+
+/**
+ * @brief skip a run of whitespace. looks at 16/32 bytes at a time once the
+ *        run is longer than two bytes. the loads are aligned and only cover
+ *        blocks that end by `s + len + EKON_PADDING`, the rest of the run is
+ *        skipped byte by byte
+ * @param s         src string
+ * @param len       length of the source
+ * @param index     index where the run starts
+ * @return          index of the first byte that is not a whitespace or `len`
+ * */
+EKON_NO_SANITIZE_ADDRESS
+u32 ekonSkipWhiteSpace(const char *s, const u32 len, u32 index) {
+  if (EKON_LIKELY(ekonSkin(ekonCharAt(s, len, index)) == false))
+    return index;
+  if (ekonSkin(ekonCharAt(s, len, ++index)) == false)
+    return index;
+#if defined(EKON_SIMD_AVX2)
+  const __m256i table = _mm256_setr_epi8(
+      ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r', 100,
+      100, ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r',
+      100, 100);
+  const char *p = s + index, *end = s + len;
+  const char *block = (const char *)((uintptr_t)p & ~(uintptr_t)31);
+  u32 from = ~0U << (p - block);
+  for (; block + 32 <= end + EKON_PADDING; block += 32, from = ~0U) {
+    const __m256i in = _mm256_load_si256((const __m256i *)block);
+    u32 other = ~(u32)_mm256_movemask_epi8(
+                    _mm256_cmpeq_epi8(in, _mm256_shuffle_epi8(table, in))) &
+                from;
+    if (block + 32 > end)
+      other |= ~0U << (end - block);
+    if (other != 0)
+      return (u32)(block - s) + ekonCtz64(other);
+  }
+  if (block > p)
+    index = (u32)(block - s);
+#elif defined(EKON_SIMD_SSE2)
+  const char *p = s + index, *end = s + len;
+  const char *block = (const char *)((uintptr_t)p & ~(uintptr_t)15);
+  u32 from = (0xFFFFU << (p - block)) & 0xFFFFU;
+  for (; block + 16 <= end + EKON_PADDING; block += 16, from = 0xFFFFU) {
+    u32 other = ~ekonWhiteMask16(block) & from;
+    if (block + 16 > end)
+      other |= 0xFFFFU << (end - block);
+    if (other != 0)
+      return (u32)(block - s) + ekonCtz64(other);
+  }
+  if (block > p)
+    index = (u32)(block - s);
+#endif
+  while (index < len && ekonSkin(s[index]))
+    ++index;
+  return index;
 }
 
 /**
  * @brief consume whitespace characters including comments
  * @param s         src string
+ * @param len       length of the source
  * @param index     pointer to index to be updated
  * @return          success/failure
  * */
-bool ekonConsumeWhiteChars(const char *s, u32 *index) {
-  while (ekonSkin(s[*index]))
-    ++(*index);
-  if (s[*index] == '/') {
-    if (ekonConsumeComment(s, index) == false)
+bool ekonConsumeWhiteChars(const char *s, const u32 len, u32 *index) {
+  *index = ekonSkipWhiteSpace(s, len, *index);
+  while (EKON_UNLIKELY(ekonCharAt(s, len, *index) == '/')) {
+    if (ekonConsumeComment(s, len, index) == false)
       return false;
+    *index = ekonSkipWhiteSpace(s, len, *index);
+  }
+  return true;
+}
+
+// ----------------------------------------------------------
+// STRUCTURAL INDEX (stage 1)
+// ----------------------------------------------------------
+
+#ifndef EKON_STRUCTURAL_BLOCKS
+// number of 64 byte blocks indexed at a time
+#define EKON_STRUCTURAL_BLOCKS 64
+#endif
+
+#ifndef EKON_STRUCTURAL_MIN_LEN
+// sources shorter than this are parsed without a structural index
+#define EKON_STRUCTURAL_MIN_LEN 512
+#endif
+
+/**
+ * Structural index of a window of the source string. Every byte a token can
+ * start at (brackets, ',', ':', opening quotes and the first byte of an
+ * unquoted scalar) has its bit set in `bits`. Whitespace, `//` comments and
+ * string contents are cleared, so the parser can jump over them with a single
+ * ctz instead of looking at each byte.
+ *
+ * The window is built lazily from the position the parser skips whitespace
+ * at. Such a position is never inside a string or a comment, so a window can
+ * always start fresh from there.
+ * */
+typedef struct {
+  const char *s;
+  u32 len;
+  u32 start;      // index of the first byte of the window
+  u32 end;        // index past the last byte of the window
+  char state;     // state at `end`: 0, '"' / '\'' (string) or '/' (comment)
+  bool escaped;   // byte at `end` is escaped by a backslash
+  u64 prevScalar; // byte before `end` is part of an unquoted scalar
+  bool glued;     // a `//` glued to an unquoted scalar was seen
+  u64 bits[EKON_STRUCTURAL_BLOCKS];
+} EkonStructurals;
+
+// character classes of a 64 byte block. one bit per byte
+typedef struct {
+  u64 ws;        // ' ' '\t' '\n' '\r'
+  u64 op;        // '[' ']' '{' '}' ',' ':'
+  u64 dquote;    // '"'
+  u64 squote;    // '\''
+  u64 backslash; // '\\'
+  u64 slash;     // '/'
+  u64 newline;   // '\n'
+} EkonBlockMasks;
+
+// mask with all the bits from `i` (< 64) upwards set
+u64 ekonMaskFrom(u32 i) { return ~0ULL << i; }
+
+// mask with the bits from `from` to `to` (both inclusive) set
+u64 ekonMaskRange(u32 from, u32 to) {
+  if (to == 63)
+    return ekonMaskFrom(from);
+  return ekonMaskFrom(from) & ((1ULL << (to + 1)) - 1);
+}
+
+// every bit becomes the xor of itself and all the bits below it
+u64 ekonPrefixXor(u64 x) {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+/**
+ * @brief classify the 64 bytes at `p` into `m`
+ * @param p     start of the block. 64 bytes must be readable
+ * @param m     masks to be filled in
+ * */
+void ekonClassifyBlock(const char *p, EkonBlockMasks *m) {
+#if defined(EKON_SIMD_AVX2)
+  // whitespace and operators through a low nibble lookup (from simdjson).
+  // '[' and ']' are turned into '{' and '}' by setting 0x20. this also flags
+  // the control bytes 0x0C and 0x1A as operators, which are invalid anyway
+  const __m256i wsTable = _mm256_setr_epi8(
+      ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r', 100,
+      100, ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r',
+      100, 100);
+  const __m256i opTable = _mm256_setr_epi8(
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', '{', ',', '}', 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 0, 0, 0, ':', '{', ',', '}', 0, 0);
+  u64 r[7] = {0, 0, 0, 0, 0, 0, 0};
+  for (u32 i = 0; i < 2; i++) {
+    const __m256i in = _mm256_loadu_si256((const __m256i *)(p + i * 32));
+    const __m256i curly = _mm256_or_si256(in, _mm256_set1_epi8(0x20));
+    const u32 shift = i * 32;
+    r[0] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, _mm256_shuffle_epi8(wsTable, in)))
+            << shift;
+    r[1] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(curly, _mm256_shuffle_epi8(opTable, in)))
+            << shift;
+    r[2] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, _mm256_set1_epi8('"')))
+            << shift;
+    r[3] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\'')))
+            << shift;
+    r[4] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\\')))
+            << shift;
+    r[5] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/')))
+            << shift;
+    r[6] |= (u64)(u32)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\n')))
+            << shift;
+  }
+  m->ws = r[0], m->op = r[1], m->dquote = r[2], m->squote = r[3];
+  m->backslash = r[4], m->slash = r[5], m->newline = r[6];
+#elif defined(EKON_SIMD_SSE2)
+  u64 r[7] = {0, 0, 0, 0, 0, 0, 0};
+  for (u32 i = 0; i < 4; i++) {
+    const __m128i in = _mm_loadu_si128((const __m128i *)(p + i * 16));
+    const __m128i curly = _mm_or_si128(in, _mm_set1_epi8(0x20));
+    const __m128i nl = _mm_cmpeq_epi8(in, _mm_set1_epi8('\n'));
+    const __m128i ws = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(' ')), nl),
+        _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('\t')),
+                     _mm_cmpeq_epi8(in, _mm_set1_epi8('\r'))));
+    const __m128i op = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(curly, _mm_set1_epi8('{')),
+                     _mm_cmpeq_epi8(curly, _mm_set1_epi8('}'))),
+        _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(',')),
+                     _mm_cmpeq_epi8(in, _mm_set1_epi8(':'))));
+    const u32 shift = i * 16;
+    r[0] |= (u64)(u32)_mm_movemask_epi8(ws) << shift;
+    r[1] |= (u64)(u32)_mm_movemask_epi8(op) << shift;
+    r[2] |= (u64)(u32)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(in, _mm_set1_epi8('"')))
+            << shift;
+    r[3] |= (u64)(u32)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(in, _mm_set1_epi8('\'')))
+            << shift;
+    r[4] |= (u64)(u32)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(in, _mm_set1_epi8('\\')))
+            << shift;
+    r[5] |= (u64)(u32)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(in, _mm_set1_epi8('/')))
+            << shift;
+    r[6] |= (u64)(u32)_mm_movemask_epi8(nl) << shift;
+  }
+  m->ws = r[0], m->op = r[1], m->dquote = r[2], m->squote = r[3];
+  m->backslash = r[4], m->slash = r[5], m->newline = r[6];
+#else
+  memset(m, 0, sizeof(EkonBlockMasks));
+  for (u32 i = 0; i < 64; i++) {
+    const u64 bit = 1ULL << i;
+    switch (p[i]) {
+    case '\n':
+      m->newline |= bit;
+      m->ws |= bit;
+      break;
+    case ' ':
+    case '\t':
+    case '\r':
+      m->ws |= bit;
+      break;
+    case '[':
+    case ']':
+    case '{':
+    case '}':
+    case ',':
+    case ':':
+      m->op |= bit;
+      break;
+    case '"':
+      m->dquote |= bit;
+      break;
+    case '\'':
+      m->squote |= bit;
+      break;
+    case '\\':
+      m->backslash |= bit;
+      break;
+    case '/':
+      m->slash |= bit;
+      break;
+    default:
+      break;
+    }
+  }
+#endif
+}
+
+/**
+ * @brief index the window starting at `from`. Continues from the state at
+ *        `st->end` so a window can be extended right where the last one ended
+ * @param st        structural index to fill in
+ * @param from      index in the source where the window starts
+ * */
+void ekonStructuralsBuild(EkonStructurals *st, u32 from) {
+  const char *s = st->s;
+  const u32 len = st->len;
+  char pad[64];
+
+  st->start = from;
+  for (u32 b = 0; b < EKON_STRUCTURAL_BLOCKS && from < len; b++, from += 64) {
+    const u32 avail = len - from;
+    const char *p = s + from;
+    if (EKON_UNLIKELY(avail < 64)) {
+      memset(pad, 0, 64);
+      memcpy(pad, p, avail);
+      p = pad;
+    }
+
+    EkonBlockMasks m;
+    ekonClassifyBlock(p, &m);
+    const u64 scalar = ~(m.ws | m.op | m.dquote | m.squote);
+    u64 inside = 0;
+    u32 pos = st->escaped ? 1 : 0, regionStart = 0;
+
+    if (EKON_LIKELY((m.squote | m.backslash | m.slash) == 0 &&
+                    (st->state == 0 || st->state == '"') && pos == 0)) {
+      // only double quotes: strings are the prefix xor of the quotes
+      const u64 carry = st->state == '"';
+      const u64 inStr = ekonPrefixXor(m.dquote) ^ (0 - carry);
+      inside = (inStr << 1) | carry;
+      st->state = (inStr >> 63) ? '"' : 0;
+    } else {
+      // walk quotes, backslashes, slashes and newlines to find the strings and
+      // comments in this block
+      while (pos < 64) {
+        if (st->state == 0) {
+          const u64 cand = (m.dquote | m.squote | m.slash) & ekonMaskFrom(pos);
+          if (cand == 0)
+            break;
+          const u32 i = ekonCtz64(cand);
+          if (((m.slash >> i) & 1) == 0) {
+            st->state = p[i];
+            regionStart = pos = i + 1;
+            continue;
+          }
+          // a `//` only starts a comment when not glued to an unquoted scalar
+          const char next = i < 63 ? p[i + 1] : ekonCharAt(s, len, from + 64);
+          const u64 prev = i > 0 ? (scalar >> (i - 1)) & 1 : st->prevScalar;
+          if (next == '/' && prev == 0) {
+            st->state = '/';
+            regionStart = i;
+            pos = i + 2;
+          } else {
+            st->glued |= next == '/';
+            pos = i + 1;
+          }
+        } else if (st->state == '/') {
+          const u64 cand = m.newline & ekonMaskFrom(pos);
+          if (cand == 0)
+            break;
+          const u32 i = ekonCtz64(cand);
+          inside |= ekonMaskRange(regionStart, i);
+          st->state = 0;
+          pos = i + 1;
+        } else {
+          const u64 quote = st->state == '"' ? m.dquote : m.squote;
+          const u64 cand = (quote | m.backslash) & ekonMaskFrom(pos);
+          if (cand == 0)
+            break;
+          const u32 i = ekonCtz64(cand);
+          if ((m.backslash >> i) & 1) {
+            pos = i + 2;
+          } else {
+            inside |= ekonMaskRange(regionStart, i);
+            st->state = 0;
+            pos = i + 1;
+          }
+        }
+      }
+      if (st->state != 0 && regionStart < 64)
+        inside |= ekonMaskFrom(regionStart);
+      st->escaped = st->state != 0 && st->state != '/' && pos == 65;
+    }
+
+    const u64 valid = avail < 64 ? (1ULL << avail) - 1 : ~0ULL;
+    const u64 significant = ~(m.ws | inside) & valid;
+    const u64 sc = significant & scalar;
+    st->bits[b] = significant & ~(sc & ((sc << 1) | st->prevScalar));
+    st->prevScalar = sc >> 63;
+  }
+  st->end = from < len ? from : len;
+}
+
+/**
+ * @brief reset the index so that the next lookup starts a new window
+ * @param st        structural index
+ * @param s         source string
+ * @param len       length of `s`
+ * */
+void ekonStructuralsInit(EkonStructurals *st, const char *s, u32 len) {
+  st->s = s;
+  st->len = len;
+  st->start = st->end = 0;
+  st->glued = false;
+}
+
+/**
+ * @brief find the first token at or after `index`
+ * @param st        structural index
+ * @param index     position in the source. never inside a string/comment
+ * @return          index of the next token or `len` if there is none
+ * */
+u32 ekonStructuralsNext(EkonStructurals *st, u32 index) {
+  if (EKON_UNLIKELY(index < st->start || index >= st->end)) {
+    st->state = 0;
+    st->escaped = false;
+    st->prevScalar = 0;
+    ekonStructuralsBuild(st, index);
+  }
+  for (;;) {
+    const u32 blocks = (st->end - st->start + 63) >> 6;
+    u32 off = index - st->start, b = off >> 6;
+    u64 bits = st->bits[b] & ekonMaskFrom(off & 63);
+    while (bits == 0 && ++b < blocks)
+      bits = st->bits[b];
+    if (EKON_LIKELY(bits != 0))
+      return st->start + (b << 6) + ekonCtz64(bits);
+    if (st->end >= st->len)
+      return st->len;
+    index = st->end;
+    ekonStructuralsBuild(st, index);
+  }
+}
+
+/**
+ * @brief consume whitespace characters and comments using the structural
+ *        index. falls back to ekonConsumeWhiteChars when there is no index
+ * @param s         src string
+ * @param len       length of the source
+ * @param index     pointer to index to be updated
+ * @param st        structural index or NULL
+ * @return          success/failure
+ * */
+bool ekonStructuralsSkip(const char *s, const u32 len, u32 *index,
+                         EkonStructurals *st) {
+  if (st == NULL)
+    return ekonConsumeWhiteChars(s, len, index);
+  if (ekonSkin(ekonCharAt(s, len, *index)))
+    *index = ekonStructuralsNext(st, *index);
+  if (EKON_UNLIKELY(ekonCharAt(s, len, *index) == '/')) {
+    // '/' right after a token (e.g. a comment glued to a number). the index
+    // may have read it as part of an unquoted scalar, so scan it the slow way
+    // and start a new window afterwards
+    st->start = st->end = 0;
+    return ekonConsumeWhiteChars(s, len, index);
   }
-  while (ekonSkin(s[*index]))
-    ++(*index);
   return true;
 }
 
 /**
  * @brief get s[index] and index++
  * @param s             EKON string source
+ * @param len           length of the source
  * @param index         pointer to the index. updates it
- * @return              character at the current index
+ * @param st            structural index or NULL
+ * @return              character at the current index, '\0' at the end
  * */
-char ekonPeek(const char *s, u32 *index) {
-  if (ekonConsumeWhiteChars(s, index) == false)
+char ekonPeek(const char *s, const u32 len, u32 *index, EkonStructurals *st) {
+  if (ekonStructuralsSkip(s, len, index, st) == false)
     return 0;
-  return s[(*index)++];
+  return ekonCharAt(s, len, (*index)++);
 }
 
 // consume current character. returns false if no match
-bool ekonConsume(const char c, const char *s, u32 *index) {
-  if (s[*index] == c) {
+bool ekonConsume(const char c, const char *s, const u32 len, u32 *index) {
+  if (ekonCharAt(s, len, *index) == c) {
     ++(*index);
     return true;
   }
@@ -1248,8 +3918,8 @@ bool ekonConsume(const char c, const char *s, u32 *index) {
 }
 
 // consume using likely the next character. returns false if no match
-bool ekonLikelyConsume(const char c, const char *s, u32 *index) {
-  if (EKON_LIKELY(s[*index] == c)) {
+bool ekonLikelyConsume(const char c, const char *s, const u32 len, u32 *index) {
+  if (EKON_LIKELY(ekonCharAt(s, len, *index) == c)) {
     ++(*index);
     return true;
   }
@@ -1257,8 +3927,9 @@ bool ekonLikelyConsume(const char c, const char *s, u32 *index) {
 }
 
 // consume using unlikely the next character.  returns false if no match
-bool ekonUnlikelyConsume(const char c, const char *s, u32 *index) {
-  if (EKON_UNLIKELY(s[*index] == c)) {
+bool ekonUnlikelyConsume(const char c, const char *s, const u32 len,
+                         u32 *index) {
+  if (EKON_UNLIKELY(ekonCharAt(s, len, *index) == c)) {
     ++(*index);
     return true;
   }
@@ -1267,11 +3938,12 @@ bool ekonUnlikelyConsume(const char c, const char *s, u32 *index) {
 
 // peek and consume the next non-whitespace character using likely. false for no
 // match
-bool ekonLikelyPeekAndConsume(const char c, const char *s, u32 *index) {
-  if (ekonConsumeWhiteChars(s, index) == false)
+bool ekonLikelyPeekAndConsume(const char c, const char *s, const u32 len,
+                              u32 *index, EkonStructurals *st) {
+  if (ekonStructuralsSkip(s, len, index, st) == false)
     return false;
 
-  if (EKON_LIKELY(s[*index] == c)) {
+  if (EKON_LIKELY(ekonCharAt(s, len, *index) == c)) {
     ++(*index);
     return true;
   }
@@ -1280,72 +3952,72 @@ bool ekonLikelyPeekAndConsume(const char c, const char *s, u32 *index) {
 
 // peek and consume the next non-whitespace character using unlikely. false for
 // no match
-bool ekonUnlikelyPeekAndConsume(const char c, const char *s, u32 *index) {
-  if (ekonConsumeWhiteChars(s, index) == false)
+bool ekonUnlikelyPeekAndConsume(const char c, const char *s, const u32 len,
+                                u32 *index, EkonStructurals *st) {
+  if (ekonStructuralsSkip(s, len, index, st) == false)
     return false;
 
-  if (EKON_UNLIKELY(s[*index] == c)) {
+  if (EKON_UNLIKELY(ekonCharAt(s, len, *index) == c)) {
     ++(*index);
     return true;
   }
   return false;
 }
 
-// consume a comment. also multiline comments
-bool ekonConsumeComment(const char *s, u32 *index) {
-  char curr = s[(*index)];
-  if (s[(*index)++] == '/' && s[(*index)++] == '/') {
-    if (s[*index] == '\n') {
-      (*index)++;
-      if (ekonConsumeWhiteChars(s, index) == false)
-        return false;
-      return true;
-    }
-
-    if (curr == 0)
-      return true;
-
-    while (EKON_UNLIKELY(curr != '\n' && curr != 0))
-      curr = s[(*index)++];
-
-    if (ekonConsumeWhiteChars(s, index) == false)
-      return false;
-
-    return true;
-  }
-  return false;
-}
-
-// consume 'false' string. return false if not 'false'
-bool ekonConsumeFalse(const char *s, u32 *index) {
-  if (EKON_LIKELY(*((u32 *)("alse")) == *((u32 *)(s + *index)))) {
-    *index += 4;
+/**
+ * @brief consume a `//` comment up to and including its '\n'. a comment at the
+ *        end of the source stops there
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     pointer to the index of the first '/'. updated
+ * @return          false if there is no comment at index
+ * */
+bool ekonConsumeComment(const char *s, const u32 len, u32 *index) {
+  if (ekonCharAt(s, len, (*index)++) == '/' &&
+      ekonCharAt(s, len, (*index)++) == '/') {
+    const char *nl = (const char *)memchr(s + *index, '\n', len - *index);
+    *index = nl != NULL ? (u32)(nl - s) + 1 : len;
     return true;
   }
   return false;
 }
 
-// consume 'true' string. return false if not 'true'
-bool ekonConsumeTrue(const char *s, u32 *index) {
-  if (EKON_LIKELY(*((u32 *)ekonStrTrue) == *((u32 *)(s + *index - 1)))) {
-    *index += 3;
-    return true;
-  }
-  return false;
-}
+// `null`, `true` and `false` padded to 8 bytes, each with the mask that
+// selects its length. used by ekonMatchKeyword
+static const char ekonKeywords[3][2][8] = {{"null", "\xff\xff\xff\xff"},
+                                           {"true", "\xff\xff\xff\xff"},
+                                           {"false", "\xff\xff\xff\xff\xff"}};
 
 /**
- * @brief consume `null` string
- * @param s     EKON string
- * @param index pointer to index to be updated
- * @return success/failure
+ * @brief decide in one step whether the word at `start` is the keyword its
+ *        first letter announces: a single 8-byte load masked to the keyword
+ *        length, plus a class-table check of the byte that follows it. within
+ *        the last 8 bytes of the source the word is copied into a zeroed
+ *        buffer first, so nothing past the end is read
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param start     index of the first letter of the word
+ * @param c         the first letter: 'n', 't' or 'f'
+ * @return          length of the keyword, 0 if the word is an unquoted string
  * */
-bool ekonConsumeNull(const char *s, u32 *index) {
-  if (EKON_LIKELY(*((u32 *)ekonStrNull) == *((u32 *)(s + *index - 1)))) {
-    *index += 3;
-    return true;
-  }
-  return false;
+u32 ekonMatchKeyword(const char *s, const u32 len, const u32 start,
+                     const char c) {
+  const u32 kind = c == 'n' ? 0 : c == 't' ? 1 : 2;
+  const u32 keywordLen = kind == 2 ? 5 : 4;
+  char buf[8] = {0};
+  u64 word, keyword, mask;
+
+  if (EKON_LIKELY(len - start >= 8))
+    memcpy(buf, s + start, 8);
+  else
+    memcpy(buf, s + start, len - start);
+  memcpy(&word, buf, 8);
+  memcpy(&keyword, ekonKeywords[kind][0], 8);
+  memcpy(&mask, ekonKeywords[kind][1], 8);
+
+  const bool same = ((word ^ keyword) & mask) == 0;
+  const bool ended = (ekonClass(buf[keywordLen]) & EKON_CHAR_END) != 0;
+  return (same & ended) ? keywordLen : 0;
 }
 
 // get the decimal value
@@ -1369,7 +4041,7 @@ bool ekonCharIsHex(const char c) {
          (c >= 'A' && c <= 'Z');
 }
 // check if the number is between '0' and '7'
-bool ekonCharIsOctal(const char c) { return c >= 0 && c <= '7'; }
+bool ekonCharIsOctal(const char c) { return c >= '0' && c <= '7'; }
 
 // TODO: do more inquiry on this: ekonValueGetUnEspaceStr
 u32 ekonHexCodePointForUnEscape(const char c) {
@@ -1381,8 +4053,8 @@ u32 ekonHexCodePointForUnEscape(const char c) {
 }
 
 // consume Hex one char, consume, now also update the same.
-bool ekonConsumeHexOne(const char *s, u32 *index, u32 *cp) {
-  u32 tcp = ekonHexCodePoint(s[*index]);
+bool ekonConsumeHexOne(const char *s, const u32 len, u32 *index, u32 *cp) {
+  u32 tcp = ekonHexCodePoint(ekonCharAt(s, len, *index));
   if (EKON_LIKELY(tcp < 16)) {
     *cp = *cp << 4;
     *cp += tcp;
@@ -1402,11 +4074,11 @@ void ekonConsumeHexOneForUnEscape(const char *s, u32 *index, u32 *cp) {
 
 // check if the next 4 characters represent a hex number using cp
 // if yes, return true, otherwise false
-bool ekonConsumeHex(const char *s, u32 *index, u32 *cp) {
-  if (EKON_LIKELY(EKON_LIKELY(ekonConsumeHexOne(s, index, cp)) &&
-                  EKON_LIKELY(ekonConsumeHexOne(s, index, cp)) &&
-                  EKON_LIKELY(ekonConsumeHexOne(s, index, cp)) &&
-                  EKON_LIKELY(ekonConsumeHexOne(s, index, cp)))) {
+bool ekonConsumeHex(const char *s, const u32 len, u32 *index, u32 *cp) {
+  if (EKON_LIKELY(EKON_LIKELY(ekonConsumeHexOne(s, len, index, cp)) &&
+                  EKON_LIKELY(ekonConsumeHexOne(s, len, index, cp)) &&
+                  EKON_LIKELY(ekonConsumeHexOne(s, len, index, cp)) &&
+                  EKON_LIKELY(ekonConsumeHexOne(s, len, index, cp)))) {
     return true;
   }
   return false;
@@ -1681,7 +4353,8 @@ const char *ekonEscapeStrJSON(const char *str, EkonAllocator *a,
 }
 
 // str escape len with str
-const char *ekonEscapeStrLen(const char *str, EkonAllocator *a, u32 len) {
+const char *ekonEscapeStrLen(const char *str, EkonAllocator *a, u32 len,
+                             u32 *finalLen) {
   u32 l = 0;
   const char *src = str;
   u32 srcLen = len;
@@ -1703,135 +4376,213 @@ const char *ekonEscapeStrLen(const char *str, EkonAllocator *a, u32 len) {
     --len;
   }
   ekonAppendEnd(s, &index);
+  *finalLen = l;
   return s;
 }
 
-// consume a string
-bool ekonConsumeStr(const char *s, u32 *index, const char quoteType,
-                    EkonOption *option) {
-  char c = s[*index];
-  while (EKON_LIKELY(c != 0)) {
-    if (c == '\n') {
-      if (EKON_LIKELY(quoteType != '\'')) {
-        return false;
-      } else {
-        *option |= (EKON_IS_STR_SPACED | EKON_IS_STR_MULTILINED);
-        c = s[++(*index)];
-        continue;
-      }
+/**
+ * @brief scan the plain bytes of a quoted string, 16/32 bytes at a time.
+ *        sets EKON_IS_STR_SPACED/MULTILINED for the bytes it skips. like
+ *        ekonSkipWhiteSpace, the aligned loads stop at the last block that
+ *        ends by `s + len + EKON_PADDING`
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index of the first byte to scan
+ * @param quoteType quote that closes the string
+ * @param option    options of the string. updated
+ * @return          index of the first quote, backslash or invalid control
+ *                  char, `len` if there is none. '\n' is invalid unless the
+ *                  string is '...'
+ * */
+EKON_NO_SANITIZE_ADDRESS
+u32 ekonScanStr(const char *s, const u32 len, u32 index, const char quoteType,
+                EkonOption *option) {
+  const bool isMultiline = quoteType == '\'';
+#if defined(EKON_SIMD_AVX2)
+  const char *p = s + index, *end = s + len;
+  const char *block = (const char *)((uintptr_t)p & ~(uintptr_t)31);
+  u32 from = ~0U << (p - block);
+  const __m256i nlOk = _mm256_set1_epi8(isMultiline ? '\n' : 0);
+  for (; block + 32 <= end + EKON_PADDING; block += 32, from = ~0U) {
+    const __m256i in = _mm256_load_si256((const __m256i *)block);
+    const __m256i nl = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\n'));
+    const __m256i tabCr =
+        _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8('\t')),
+                        _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\r')));
+    const __m256i ctrl = _mm256_cmpeq_epi8(
+        _mm256_min_epu8(in, _mm256_set1_epi8(0x1F)), in);
+    const __m256i allowed =
+        _mm256_or_si256(tabCr, _mm256_cmpeq_epi8(in, nlOk));
+    const __m256i stop = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(in, _mm256_set1_epi8(quoteType)),
+                        _mm256_cmpeq_epi8(in, _mm256_set1_epi8('\\'))),
+        _mm256_andnot_si256(allowed, ctrl));
+    const __m256i spaced = _mm256_or_si256(
+        _mm256_or_si256(tabCr, nl),
+        _mm256_cmpeq_epi8(in, _mm256_set1_epi8(' ')));
+    u32 stopM = (u32)_mm256_movemask_epi8(stop);
+    if (block + 32 > end)
+      stopM |= ~0U << (end - block);
+    stopM &= from;
+    u32 seen = (stopM ? (stopM & (0 - stopM)) - 1 : ~0U) & from;
+    if ((u32)_mm256_movemask_epi8(spaced) & seen)
+      *option |= EKON_IS_STR_SPACED;
+    if ((u32)_mm256_movemask_epi8(nl) & seen)
+      *option |= EKON_IS_STR_MULTILINED;
+    if (stopM)
+      return (u32)(block - s) + ekonCtz64(stopM);
+  }
+  if (block > p)
+    index = (u32)(block - s);
+#elif defined(EKON_SIMD_SSE2)
+  const char *p = s + index, *end = s + len;
+  const char *block = (const char *)((uintptr_t)p & ~(uintptr_t)15);
+  u32 from = (0xFFFFU << (p - block)) & 0xFFFFU;
+  const __m128i nlOk = _mm_set1_epi8(isMultiline ? '\n' : 0);
+  for (; block + 16 <= end + EKON_PADDING; block += 16, from = 0xFFFFU) {
+    const __m128i in = _mm_load_si128((const __m128i *)block);
+    const __m128i nl = _mm_cmpeq_epi8(in, _mm_set1_epi8('\n'));
+    const __m128i tabCr = _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8('\t')),
+                                       _mm_cmpeq_epi8(in, _mm_set1_epi8('\r')));
+    const __m128i ctrl =
+        _mm_cmpeq_epi8(_mm_min_epu8(in, _mm_set1_epi8(0x1F)), in);
+    const __m128i allowed = _mm_or_si128(tabCr, _mm_cmpeq_epi8(in, nlOk));
+    const __m128i stop = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(in, _mm_set1_epi8(quoteType)),
+                     _mm_cmpeq_epi8(in, _mm_set1_epi8('\\'))),
+        _mm_andnot_si128(allowed, ctrl));
+    const __m128i spaced = _mm_or_si128(
+        _mm_or_si128(tabCr, nl), _mm_cmpeq_epi8(in, _mm_set1_epi8(' ')));
+    u32 stopM = (u32)_mm_movemask_epi8(stop);
+    if (block + 16 > end)
+      stopM |= 0xFFFFU << (end - block);
+    stopM &= from;
+    u32 seen = (stopM ? (stopM & (0 - stopM)) - 1 : ~0U) & from;
+    if ((u32)_mm_movemask_epi8(spaced) & seen)
+      *option |= EKON_IS_STR_SPACED;
+    if ((u32)_mm_movemask_epi8(nl) & seen)
+      *option |= EKON_IS_STR_MULTILINED;
+    if (stopM)
+      return (u32)(block - s) + ekonCtz64(stopM);
+  }
+  if (block > p)
+    index = (u32)(block - s);
+#endif
+  for (; index < len; ++index) {
+    const char c = s[index];
+    if (c == ' ' || c == '\t' || c == '\r') {
+      *option |= EKON_IS_STR_SPACED;
+    } else if (c == '\n' && isMultiline) {
+      *option |= (EKON_IS_STR_SPACED | EKON_IS_STR_MULTILINED);
+    } else if (c == quoteType || c == '\\' || (unsigned char)c <= 0x1f) {
+      return index;
     }
+  }
+  return len;
+}
 
-    if (c == '\r' || c == ' ' || c == '\t') {
-      *option |= EKON_IS_STR_SPACED;
-      c = s[++(*index)];
-      continue;
+// consume a string
+bool ekonConsumeStr(const char *s, const u32 len, u32 *index,
+                    const char quoteType, EkonOption *option) {
+  for (;;) {
+    *index = ekonScanStr(s, len, *index, quoteType, option);
+    char c = ekonCharAt(s, len, *index);
+    if (EKON_LIKELY(c == quoteType)) {
+      (*index)++;
+      return true;
     }
 
-    if (EKON_UNLIKELY((unsigned char)c <= 0x1f))
+    // an invalid control char, '\n' in a "..." string or the end of source
+    if (EKON_UNLIKELY(c != '\\'))
       return false;
 
-    if (EKON_UNLIKELY(c == '\\')) {
-      c = s[++(*index)];
-      switch (c) {
-      case '\\':
-      case 'b':
-      case 'f':
-      case 'n':
-      case 'r':
-      case 't':
-      case '"':
-      case '\'':
-      case '/': {
-        c = s[++(*index)];
-        continue;
-      }
-      case 'U':
-      case 'u': {
-        c = s[++(*index)];
-        u32 cp = 0;
-        if (EKON_LIKELY(ekonConsumeHex(s, index, &cp))) {
-          // ... something to do with handling UTF16 characters
-          if (EKON_UNLIKELY(cp >= 0xDC00 && cp <= 0xDFFF))
-            return false;
-          if (EKON_UNLIKELY(cp >= 0xD800 && cp <= 0xD8FF)) {
-            if (EKON_LIKELY(ekonLikelyConsume('\\', s, index) &&
-                            ekonLikelyConsume('u', s, index))) {
-              u32 cp2 = 0;
-              if (EKON_LIKELY(ekonConsumeHex(s, index, &cp2))) {
-                if (EKON_UNLIKELY(cp2 < 0xDC00 || cp2 > 0xDFFF))
-                  return false;
-              } else {
-                return false;
-              }
-            } else
-              return false;
-          }
-          c = s[(*index)];
-        } else
+    c = ekonCharAt(s, len, ++(*index));
+    switch (c) {
+    case '\\':
+    case 'b':
+    case 'f':
+    case 'n':
+    case 'r':
+    case 't':
+    case '"':
+    case '\'':
+    case '/': {
+      ++(*index);
+      continue;
+    }
+    case 'U':
+    case 'u': {
+      ++(*index);
+      u32 cp = 0;
+      if (EKON_LIKELY(ekonConsumeHex(s, len, index, &cp))) {
+        // ... something to do with handling UTF16 characters
+        if (EKON_UNLIKELY(cp >= 0xDC00 && cp <= 0xDFFF))
           return false;
-        continue;
-      }
-      case 'x': {
-        c = s[++(*index)];
-        u32 cp = 0;
-        if (EKON_LIKELY(ekonConsumeHexOne(s, index, &cp)) &&
-            EKON_LIKELY(ekonConsumeHexOne(s, index, &cp))) {
-          if (EKON_UNLIKELY(cp >= 0xDC00 && cp <= 0XDFFF))
-            return false;
-
-          if (EKON_UNLIKELY(cp >= 0xD800 && cp <= 0xD8FF)) {
-            if (EKON_LIKELY(ekonLikelyConsume('\\', s, index) &&
-                            ekonLikelyConsume('x', s, index))) {
-              u32 cp2 = 0;
-              if (EKON_LIKELY(ekonConsumeHexOne(s, index, &cp)) &&
-                  EKON_LIKELY(ekonConsumeHexOne(s, index, &cp))) {
-                if (EKON_UNLIKELY(cp2 < 0xDC00 || cp2 > 0xDFFF))
-                  return false;
-              }
-              return false;
+        if (EKON_UNLIKELY(cp >= 0xD800 && cp <= 0xD8FF)) {
+          if (EKON_LIKELY(ekonLikelyConsume('\\', s, len, index) &&
+                          ekonLikelyConsume('u', s, len, index))) {
+            u32 cp2 = 0;
+            if (EKON_LIKELY(ekonConsumeHex(s, len, index, &cp2))) {
+              if (EKON_UNLIKELY(cp2 < 0xDC00 || cp2 > 0xDFFF))
+                return false;
             } else {
               return false;
             }
-          }
-          c = s[(*index)];
-        } else
-          return false;
-        continue;
-      }
-      default: {
-      }
-      }
+          } else
+            return false;
+        }
+      } else
+        return false;
+      continue;
     }
+    case 'x': {
+      ++(*index);
+      u32 cp = 0;
+      if (EKON_LIKELY(ekonConsumeHexOne(s, len, index, &cp)) &&
+          EKON_LIKELY(ekonConsumeHexOne(s, len, index, &cp))) {
+        if (EKON_UNLIKELY(cp >= 0xDC00 && cp <= 0XDFFF))
+          return false;
 
-    /* if ((*option & EKON_IS_STR_SPACED) == 0 && */
-    /*     (c == '[' || c == ']' || c == ':' || c == '{' || c == '}' || */
-    /*      c == ',')) { */
-    /*   *option |= EKON_IS_STR_SPACED; */
-    /* } */
-
-    if (EKON_UNLIKELY(c == quoteType)) {
-      (*index)++;
-      return true;
+        if (EKON_UNLIKELY(cp >= 0xD800 && cp <= 0xD8FF)) {
+          if (EKON_LIKELY(ekonLikelyConsume('\\', s, len, index) &&
+                          ekonLikelyConsume('x', s, len, index))) {
+            u32 cp2 = 0;
+            if (EKON_LIKELY(ekonConsumeHexOne(s, len, index, &cp)) &&
+                EKON_LIKELY(ekonConsumeHexOne(s, len, index, &cp))) {
+              if (EKON_UNLIKELY(cp2 < 0xDC00 || cp2 > 0xDFFF))
+                return false;
+            }
+            return false;
+          } else {
+            return false;
+          }
+        }
+      } else
+        return false;
+      continue;
+    }
+    case 0:
+      return false;
+    default: {
+      // unknown escapes are taken as they are
+      ++(*index);
+      continue;
+    }
     }
-
-    c = s[++(*index)];
   }
-  return false;
 }
 
 /**
  * @brief Consumes schema.
  * @param s         EKON string
+ * @param len       length of the source
  * @param index     pointer to the index to be updated
  * @return          success/failure
  * */
-bool ekonConsumeSchema(const char *s, u32 *index) {
-  char c = s[*index];
-  while (EKON_LIKELY(c != 0)) {
-    if (EKON_UNLIKELY(c == '`')) {
+bool ekonConsumeSchema(const char *s, const u32 len, u32 *index) {
+  while (EKON_LIKELY(*index < len)) {
+    if (EKON_UNLIKELY(s[(*index)++] == '`'))
       return true;
-    }
-    c = s[(*index)++];
   }
   return false;
 }
@@ -1839,19 +4590,17 @@ bool ekonConsumeSchema(const char *s, u32 *index) {
 /**
  * @brief consume an unquoted string from EKON String
  * @param s         EKON string
+ * @param len       length of the source
  * @param index     pointer to the index that is to be updated
  * @return          success/failure
  **/
-bool ekonConsumeUnquotedStr(const char *s, u32 *index) {
-  char c = s[(*index)];
-  while (EKON_LIKELY(c != 0)) {
-    if (ekonIsNonUnquotedStrChar(c))
-      return true;
-    if (EKON_UNLIKELY((unsigned char)c <= 0x1f))
-      return false;
-    c = s[++(*index)];
-  }
-  return true;
+bool ekonConsumeUnquotedStr(const char *s, const u32 len, u32 *index) {
+  u8 cls = ekonClass(ekonCharAt(s, len, *index));
+  while (EKON_LIKELY((cls & (EKON_CHAR_END | EKON_CHAR_CONTROL)) == 0))
+    cls = ekonClass(ekonCharAt(s, len, ++(*index)));
+  // the end of the source and whitespace end the string, other control chars
+  // are invalid
+  return (cls & EKON_CHAR_END) != 0;
 }
 
 /**
@@ -1861,6 +4610,7 @@ bool ekonConsumeUnquotedStr(const char *s, u32 *index) {
  * @param[out]  option      option for the string
  * */
 bool ekonCheckStr(const char *s, u32 *len, EkonOption *option) {
+  const u32 srcLen = EKON_NUL_TERMINATED;
   u32 index = 0;
   char c = s[index++];
   while (EKON_LIKELY(c != 0)) {
@@ -1894,15 +4644,15 @@ bool ekonCheckStr(const char *s, u32 *len, EkonOption *option) {
         continue;
       case 'u': {
         u32 cp = 0;
-        if (EKON_LIKELY(ekonConsumeHex(s, &index, &cp))) {
+        if (EKON_LIKELY(ekonConsumeHex(s, srcLen, &index, &cp))) {
           // UTF16 and UNICODE support ....
           if (EKON_UNLIKELY(cp >= 0xDC00 && cp <= 0xDFFFF))
             return false;
           if (EKON_UNLIKELY(cp >= 0xD800 && cp <= 0xD8FF)) {
-            if (EKON_LIKELY(ekonLikelyConsume('\\', s, &index) &&
-                            ekonLikelyConsume('u', s, &index))) {
+            if (EKON_LIKELY(ekonLikelyConsume('\\', s, srcLen, &index) &&
+                            ekonLikelyConsume('u', s, srcLen, &index))) {
               u32 cp2 = 0;
-              if (EKON_LIKELY(ekonConsumeHex(s, &index, &cp2))) {
+              if (EKON_LIKELY(ekonConsumeHex(s, srcLen, &index, &cp2))) {
                 if (EKON_UNLIKELY(cp2 < 0xDC00 || cp2 > 0xDFFF))
                   return false;
               } else
@@ -1917,16 +4667,16 @@ bool ekonCheckStr(const char *s, u32 *len, EkonOption *option) {
       }
       case 'x': {
         u32 cp = 0;
-        if (EKON_LIKELY(ekonConsumeHexOne(s, &index, &cp)) &&
-            EKON_LIKELY(ekonConsumeHexOne(s, &index, &cp))) {
+        if (EKON_LIKELY(ekonConsumeHexOne(s, srcLen, &index, &cp)) &&
+            EKON_LIKELY(ekonConsumeHexOne(s, srcLen, &index, &cp))) {
           if (EKON_UNLIKELY(cp >= 0xDC00 && cp <= 0xDFFFF))
             return false;
           if (EKON_UNLIKELY(cp >= 0xD800 && cp <= 0xD8FF)) {
-            if (EKON_LIKELY(ekonLikelyConsume('\\', s, &index) &&
-                            ekonLikelyConsume('x', s, &index))) {
+            if (EKON_LIKELY(ekonLikelyConsume('\\', s, srcLen, &index) &&
+                            ekonLikelyConsume('x', s, srcLen, &index))) {
               u32 cp2 = 0;
-              if (EKON_LIKELY(ekonConsumeHexOne(s, &index, &cp)) &&
-                  EKON_LIKELY(ekonConsumeHexOne(s, &index, &cp))) {
+              if (EKON_LIKELY(ekonConsumeHexOne(s, srcLen, &index, &cp)) &&
+                  EKON_LIKELY(ekonConsumeHexOne(s, srcLen, &index, &cp))) {
                 if (EKON_UNLIKELY(cp2 < 0xDC00 || cp2 > 0xDFFF))
                   return false;
               } else
@@ -1952,19 +4702,19 @@ bool ekonCheckStr(const char *s, u32 *len, EkonOption *option) {
 // Check string with length
 bool ekonCheckStrLen(EkonAllocator *alloc, const char *s, u32 len,
                      EkonOption *option) {
-  if (EKON_UNLIKELY(ekonStringCache == 0)) {
-    ekonStringCache = ekonStringNew(alloc, ekonStringCacheInitMemSize);
-    if (EKON_UNLIKELY(ekonStringCache == 0))
+  if (EKON_UNLIKELY(alloc->scratch == 0)) {
+    alloc->scratch = ekonStringNew(alloc, ekonStringCacheInitMemSize);
+    if (EKON_UNLIKELY(alloc->scratch == 0))
       return false;
   } else {
-    ekonStringReset(ekonStringCache);
+    ekonStringReset(alloc->scratch);
   }
 
-  if (EKON_UNLIKELY(ekonStringAppendStr(ekonStringCache, s, len) == false))
+  if (EKON_UNLIKELY(ekonStringAppendStr(alloc->scratch, s, len) == false))
     return false;
-  ekonStringAppendEnd(ekonStringCache);
+  ekonStringAppendEnd(alloc->scratch);
   u32 avail_len;
-  if (EKON_UNLIKELY(ekonCheckStr(ekonStringStr(ekonStringCache), &avail_len,
+  if (EKON_UNLIKELY(ekonCheckStr(ekonStringStr(alloc->scratch), &avail_len,
                                  option) == false))
     return false;
   if (EKON_UNLIKELY(avail_len != len))
@@ -1975,38 +4725,40 @@ bool ekonCheckStrLen(EkonAllocator *alloc, const char *s, u32 len,
 /**
  * @brief check if a string is a number
  * @param s The start of the string you want to check
+ * @param len The number of bytes left in the source from `s`
  * @param outLen Updates the length of the string
  * @return -1 means last letter is 0, 1 means success, 0 means failure
  * */
-i8 ekonCheckNumWithoutEnd(const char *s, u32 *outLen, EkonOption *option) {
+i8 ekonCheckNumWithoutEnd(const char *s, const u32 len, u32 *outLen,
+                          EkonOption *option) {
   u32 index = 0;
 
-  if (s[index] == '-' || s[index] == '+')
+  if (ekonCharAt(s, len, index) == '-' || ekonCharAt(s, len, index) == '+')
     ++(index);
 
   // consume hex, binary, octal numbers
-  if (ekonUnlikelyConsume('0', s, &index)) {
+  if (ekonUnlikelyConsume('0', s, len, &index)) {
     // only 0
-    if (ekonIsNonUnquotedStrChar(s[index])) {
+    if (ekonIsNonUnquotedStrChar(ekonCharAt(s, len, index))) {
       *option |= EKON_IS_NUM_INT;
       *outLen = index;
-      if (s[index] == '\0')
+      if (ekonCharAt(s, len, index) == '\0')
         return -1;
       return 1;
     }
 
     // consume hex
-    if (ekonLikelyConsume('x', s, &index) ||
-        ekonLikelyConsume('X', s, &index)) {
-      if (ekonCharIsHex(s[index++])) {
-        while (ekonCharIsHex(s[index]) || s[index] == '_') {
-          index++;
-        }
-        if (s[index - 1] == '_')
+    if (ekonLikelyConsume('x', s, len, &index) ||
+        ekonLikelyConsume('X', s, len, &index)) {
+      if (ekonCharIsHex(ekonCharAt(s, len, index++))) {
+        char c = ekonCharAt(s, len, index);
+        while (ekonCharIsHex(c) || c == '_')
+          c = ekonCharAt(s, len, ++index);
+        if (ekonCharAt(s, len, index - 1) == '_')
           return false; // return false if the last digit is '_'
-        if (ekonIsNonUnquotedStrChar(s[index])) {
+        if (ekonIsNonUnquotedStrChar(ekonCharAt(s, len, index))) {
           *outLen = index;
-          if (s[index] == '\0')
+          if (ekonCharAt(s, len, index) == '\0')
             return -1;
           *option |= EKON_IS_NUM_HEXADECIMAL;
           return 1;
@@ -2016,16 +4768,16 @@ i8 ekonCheckNumWithoutEnd(const char *s, u32 *outLen, EkonOption *option) {
     }
 
     // consume binary
-    if (ekonLikelyConsume('b', s, &index)) {
-      if (ekonCharIsBinary(s[index++])) {
-        while (ekonCharIsBinary(s[index]) || s[index] == '_') {
-          index++;
-        }
-        if (s[index - 1] == '_')
+    if (ekonLikelyConsume('b', s, len, &index)) {
+      if (ekonCharIsBinary(ekonCharAt(s, len, index++))) {
+        char c = ekonCharAt(s, len, index);
+        while (ekonCharIsBinary(c) || c == '_')
+          c = ekonCharAt(s, len, ++index);
+        if (ekonCharAt(s, len, index - 1) == '_')
           return false; // return false if the last digit is '_'
-        if (ekonIsNonUnquotedStrChar(s[index])) {
+        if (ekonIsNonUnquotedStrChar(ekonCharAt(s, len, index))) {
           *outLen = index;
-          if (s[index] == '\0')
+          if (ekonCharAt(s, len, index) == '\0')
             return -1;
           *option |= EKON_IS_NUM_BINARY;
           return 1;
@@ -2035,75 +4787,78 @@ i8 ekonCheckNumWithoutEnd(const char *s, u32 *outLen, EkonOption *option) {
     }
 
     // consume octal numbers
-    if (ekonLikelyConsume('o', s, &index)) {
-      if (ekonCharIsOctal(s[index++])) {
-        while (ekonCharIsOctal(s[index]) || s[index] == '_') {
-          index++;
-        }
-        if (s[index - 1] == '_')
+    if (ekonLikelyConsume('o', s, len, &index)) {
+      if (ekonCharIsOctal(ekonCharAt(s, len, index++))) {
+        char c = ekonCharAt(s, len, index);
+        while (ekonCharIsOctal(c) || c == '_')
+          c = ekonCharAt(s, len, ++index);
+        if (ekonCharAt(s, len, index - 1) == '_')
           return false; // return false if the last digit is '_'
-        if (ekonIsNonUnquotedStrChar(s[index])) {
+        if (ekonIsNonUnquotedStrChar(ekonCharAt(s, len, index))) {
           *outLen = index;
-          if (s[index] == '\0')
+          if (ekonCharAt(s, len, index) == '\0')
             return -1;
           *option |= EKON_IS_NUM_OCTAL;
-          return 0;
+          return 1;
         }
       }
       return 0;
     }
 
-    if (s[index] != '.' || s[index] != 'e' || s[index] != 'E') {
+    const char c = ekonCharAt(s, len, index);
+    if (c != '.' && c != 'e' && c != 'E') {
       return false;
     }
-  } else if (EKON_LIKELY(ekonCharIsDecimal(s[index]))) {
-    char c = s[++index];
+  } else if (EKON_LIKELY(ekonCharIsDecimal(ekonCharAt(s, len, index)))) {
+    char c = ekonCharAt(s, len, ++index);
     while (EKON_LIKELY(ekonCharIsDecimal(c)) || c == '_')
-      c = s[++index];
-    if (s[index - 1] == '_') // last digit cannot be _
+      c = ekonCharAt(s, len, ++index);
+    if (ekonCharAt(s, len, index - 1) == '_') // last digit cannot be _
       return false;
     *option |= EKON_IS_NUM_INT;
-  } else {
-    return false;
+  } else if (ekonCharAt(s, len, index) != '.' ||
+             !ekonCharIsDecimal(ekonCharAt(s, len, index + 1))) {
+    return false; // `.5` is read as a fraction below
   }
 
-  if (ekonConsume('.', s, &index)) {
-    char c = s[index];
+  if (ekonConsume('.', s, len, &index)) {
+    char c = ekonCharAt(s, len, index);
     if (EKON_LIKELY(ekonCharIsDecimal(c))) {
-      c = s[++index];
+      c = ekonCharAt(s, len, ++index);
       while (EKON_LIKELY(ekonCharIsDecimal(c)) || c == '_')
-        c = s[++index];
-      if (s[index - 1] == '_')
+        c = ekonCharAt(s, len, ++index);
+      if (ekonCharAt(s, len, index - 1) == '_')
         return false;
-      *option &= ~EKON_IS_NUM_INT; // remove if int is there
-      *option |= EKON_IS_NUM_FLOAT;
-    } else
-      return false;
+    } else if ((c | 0x20) != 'e' && !ekonIsNonUnquotedStrChar(c)) {
+      return false; // `5.` is 5.0, but `5.x` is a string
+    }
+    *option &= ~EKON_IS_NUM_INT; // remove if int is there
+    *option |= EKON_IS_NUM_FLOAT;
   }
 
-  if (s[index] == 'e' || s[index] == 'E') {
-    char c = s[++index];
+  if (ekonCharAt(s, len, index) == 'e' || ekonCharAt(s, len, index) == 'E') {
+    char c = ekonCharAt(s, len, ++index);
     if (c == '-' || c == '+')
-      c = s[++index];
+      c = ekonCharAt(s, len, ++index);
 
     if (EKON_LIKELY(ekonCharIsDecimal(c))) {
-      c = s[++index];
+      c = ekonCharAt(s, len, ++index);
       while (EKON_LIKELY(ekonCharIsDecimal(c)) || c == '_')
-        c = s[++index];
-      if (s[index - 1] == '_')
+        c = ekonCharAt(s, len, ++index);
+      if (ekonCharAt(s, len, index - 1) == '_')
         return false;
     } else
       return false;
   }
 
   *outLen = index;
-  return s[index] == '\0' ? -1 : 1;
+  return ekonCharAt(s, len, index) == '\0' ? -1 : 1;
 }
 
 // check a string is a number. note: string should end with '\0'
 bool ekonCheckNum(const char *s, u32 *outLen) {
   EkonOption option = 0;
-  i8 res = ekonCheckNumWithoutEnd(s, outLen, &option);
+  i8 res = ekonCheckNumWithoutEnd(s, EKON_NUL_TERMINATED, outLen, &option);
   if (res == 0 || res == 1) {
     return false;
   }
@@ -2111,10 +4866,11 @@ bool ekonCheckNum(const char *s, u32 *outLen) {
 }
 
 // consume a number - hex,
-bool ekonConsumeNum(const char *s, u32 *index, EkonOption *option) {
-  u32 len = 0;
-  if (ekonCheckNumWithoutEnd(s + *index, &len, option) != 0) {
-    *index += len;
+bool ekonConsumeNum(const char *s, const u32 len, u32 *index,
+                    EkonOption *option) {
+  u32 numLen = 0;
+  if (ekonCheckNumWithoutEnd(s + *index, len - *index, &numLen, option) != 0) {
+    *index += numLen;
     return true;
   }
   return false;
@@ -2122,21 +4878,21 @@ bool ekonConsumeNum(const char *s, u32 *index, EkonOption *option) {
 
 // check for the length of a number
 bool ekonCheckNumLen(EkonAllocator *alloc, const char *s, u32 len) {
-  if (EKON_UNLIKELY(ekonStringCache == 0)) {
-    ekonStringCache = ekonStringNew(alloc, ekonStringCacheInitMemSize);
-    if (EKON_UNLIKELY(ekonStringCache == 0))
+  if (EKON_UNLIKELY(alloc->scratch == 0)) {
+    alloc->scratch = ekonStringNew(alloc, ekonStringCacheInitMemSize);
+    if (EKON_UNLIKELY(alloc->scratch == 0))
       return false;
   } else {
-    ekonStringReset(ekonStringCache);
+    ekonStringReset(alloc->scratch);
   }
 
-  if (EKON_UNLIKELY(ekonStringAppendStr(ekonStringCache, s, len)) == false)
+  if (EKON_UNLIKELY(ekonStringAppendStr(alloc->scratch, s, len)) == false)
     return false;
-  if (EKON_UNLIKELY(ekonStringAppendEnd(ekonStringCache) == false))
+  if (EKON_UNLIKELY(ekonStringAppendEnd(alloc->scratch) == false))
     return false;
 
   u32 avail_len;
-  if (EKON_UNLIKELY(ekonCheckNum(ekonStringStr(ekonStringCache), &avail_len) ==
+  if (EKON_UNLIKELY(ekonCheckNum(ekonStringStr(alloc->scratch), &avail_len) ==
                     false))
     return false;
 
@@ -2157,24 +4913,22 @@ void ekonNodeAddStr(EkonNode *node, const char *s, u32 len, EkonOption option) {
   node->value.str = s;
   node->len = len;
   node->ekonType = EKON_TYPE_STRING;
-  if (node->father && node->father->ekonType == EKON_TYPE_OBJECT)
-    (node->hashItem->value) = node;
 }
 
 /*
  * @brief fill a node as EKON_TYPE_NULL node
  */
 void ekonNodeAddNull(EkonNode *node) {
+  node->option = 0;
   node->ekonType = EKON_TYPE_NULL;
   node->value.str = ekonStrNull;
   node->len = 4;
-  if (node->father && node->father->ekonType == EKON_TYPE_OBJECT)
-    node->hashItem->value = node;
 }
 /*
- * @brief fill a node as EKON_TYPE_NULL node
+ * @brief fill a node as EKON_TYPE_BOOL node
  */
 void ekonNodeAddBoolean(EkonNode *node, bool val) {
+  node->option = 0;
   node->ekonType = EKON_TYPE_BOOL;
   if (val == true) {
     node->value.str = ekonStrTrue;
@@ -2183,8 +4937,6 @@ void ekonNodeAddBoolean(EkonNode *node, bool val) {
     node->value.str = ekonStrFalse;
     node->len = 5;
   }
-  if (node->father && node->father->ekonType == EKON_TYPE_OBJECT)
-    node->hashItem->value = node;
 }
 
 void ekonNodeAddNumber(EkonNode *node, const char *s, u32 len,
@@ -2193,8 +4945,6 @@ void ekonNodeAddNumber(EkonNode *node, const char *s, u32 len,
   node->len = len;
   node->option = option;
   node->ekonType = EKON_TYPE_NUMBER;
-  if (node->father && node->father->ekonType == EKON_TYPE_OBJECT)
-    node->hashItem->value = node;
 }
 
 /**
@@ -2206,12 +4956,12 @@ void ekonNodeAddNumber(EkonNode *node, const char *s, u32 len,
  * @param index index of where the error occurred
  * */
 bool ekonSrcNodeError(EkonNode *srcNode, EkonValue *v, const char *s,
-                      char **errMessage, u32 index) {
+                      const u32 len, char **errMessage, u32 index) {
   if (EKON_LIKELY(srcNode == 0))
     v->n = srcNode;
   else
     *v->n = *srcNode;
-  return ekonParseError(errMessage, s, index);
+  return ekonParseErrorLen(errMessage, s, len, index);
 }
 
 typedef enum { EKON_OPT_IS_OBJ = 1, EKON_OPT_IS_ROOT_OBJ = 2 } EkonNodeOpt;
@@ -2224,49 +4974,43 @@ typedef enum { EKON_OPT_IS_OBJ = 1, EKON_OPT_IS_ROOT_OBJ = 2 } EkonNodeOpt;
  * @param v             main value of the node, the allocator is relevant
  * @param srcNode       I still don't know what srcNode is. TODO
  * @param s             the original string of EKON text
+ * @param len           length of the source
  * @param index         index pointer to current cursor for s buffer
+ * @param st            structural index or NULL
  * @param errMessage    pointer for the errMessage to be stored
  * @param addObjOpt     (EKON_OPT_IS_OBJ | EKON_OPT_IS_ROOT_OBJ)
  * @return              sucess/failure
  * */
 bool ekonNodeAddObjOrArrNode(EkonNode **outNode, EkonValue *v,
-                             EkonNode *srcNode, const char *s, u32 *index,
+                             EkonNode *srcNode, const char *s, const u32 len,
+                             u32 *index, EkonStructurals *st,
                              char **errMessage, const EkonNodeOpt addObjOpt) {
   const bool isObj = (addObjOpt & EKON_OPT_IS_OBJ) != 0;
   const bool isRootObj = (addObjOpt & EKON_OPT_IS_ROOT_OBJ);
 
+  // the keymap is made once the object has EKON_KEYMAP_MIN_KEYS keys
+  (*outNode)->keymap = 0;
   if (isObj == false) {
     (*outNode)->ekonType = EKON_TYPE_ARRAY;
-    if (ekonUnlikelyPeekAndConsume(']', s, index)) {
+    if (ekonUnlikelyPeekAndConsume(']', s, len, index, st)) {
       (*outNode)->value.node = 0;
       (*outNode)->len = 0;
       return true;
     }
   } else {
     (*outNode)->ekonType = EKON_TYPE_OBJECT;
-    if (isRootObj == false && ekonUnlikelyPeekAndConsume('}', s, index)) {
+    if (isRootObj == false &&
+        ekonUnlikelyPeekAndConsume('}', s, len, index, st)) {
       (*outNode)->value.node = 0;
       (*outNode)->len = 0;
       return true;
     }
   }
 
-  if ((*outNode)->father && (*outNode)->father->ekonType == EKON_TYPE_OBJECT) {
-    (*outNode)->hashItem->value = *outNode;
-  }
-
-  if (isObj == true) {
-    EkonHashmap *map =
-        (EkonHashmap *)ekonAllocatorAlloc(v->a, sizeof(EkonHashmap));
-    if (ekonHashmapInit(v->a, 16, map) == false)
-      return false;
-    (*outNode)->keymap = map;
-  }
-
   EkonNode *n = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
 
   if (EKON_UNLIKELY(n == 0))
-    return ekonSrcNodeError(srcNode, v, s, errMessage, *index);
+    return ekonSrcNodeError(srcNode, v, s, len, errMessage, *index);
 
   n->father = *outNode;
   n->prev = 0;
@@ -2279,554 +5023,2240 @@ bool ekonNodeAddObjOrArrNode(EkonNode **outNode, EkonValue *v,
 }
 
 /**
- * @brief add a key to the node
- * @param a             EkonAllocator where the memory allocation happens
- * @param node          EkonNode where the key is to be added
+ * @brief consume a key, quoted or not
  * @param s             Ekon string which is to be parsed
+ * @param len           length of the source
  * @param index         index to be updated
- * @param option        key options (EKON_NODE_OPTIONS)
+ * @param outStart      index of the first char of the key
+ * @param outKeyLen     length of the key
+ * @param outHash       ekonHashmapHash of the key, or NULL to not hash it
+ * @param option        key options (EKON_NODE_OPTIONS). updated
  * @param errMessage    errMessage where the error message is to be stored
  * @return              success/failure
  * */
-bool ekonNodeAddKey(EkonAllocator *a, EkonNode *node, const char *s, u32 *index,
-                    EkonOption *option, char **errMessage) {
-  EkonHashmap *keymap = node->father->keymap;
-  bool isKeyUnquoted = ekonIsQuote(s[(*index)]) == false;
+bool ekonConsumeKey(const char *s, const u32 len, u32 *index, u32 *outStart,
+                    u32 *outKeyLen, u32 *outHash, EkonOption *option,
+                    char **errMessage) {
+  bool isKeyUnquoted = ekonIsQuote(ekonCharAt(s, len, *index)) == false;
 
   if (isKeyUnquoted) {
-    u32 start = *index;
-    if (ekonConsumeUnquotedStr(s, index)) {
-      u32 keyLen = (*index) - start;
-      const char *key = s + start;
-      if (ekonHashmapGet(keymap, key, keyLen) != NULL) {
-        return ekonDuplicateKeyError(errMessage, s, start, keyLen);
-      } else {
-        node->key = key;
-        node->keyLen = keyLen;
-        node->option = *option;
-        EkonHashmapItem **item =
-            (EkonHashmapItem **)(malloc(sizeof(EkonHashmapItem *)));
-        ekonHashmapPut(a, keymap, key, keyLen, NULL, item);
-        node->hashItem = *item;
-      }
-    } else {
-      return ekonParseError(errMessage, s, *index);
+    *outStart = *index;
+    if (ekonConsumeUnquotedStr(s, len, index) == false)
+      return ekonParseErrorLen(errMessage, s, len, *index);
+    *outKeyLen = *index - *outStart;
+    // hashed once scanned, while its bytes are still in L1: the hash reads
+    // them a word at a time, which a byte-wise scan cannot
+    if (outHash != NULL)
+      *outHash = ekonHashmapHash(s + *outStart, *outKeyLen);
+    return true;
+  }
+
+  char quoteType = s[*index];
+  if (quoteType == '"')
+    *option |= EKON_IS_KEY_ESCAPABLE;
+
+  *outStart = ++(*index);
+  if (EKON_UNLIKELY(ekonUnlikelyConsume(quoteType, s, len, index)))
+    return ekonEmptyKeyError(errMessage, s, *index);
+  if (EKON_UNLIKELY(ekonConsumeStr(s, len, index, quoteType, option) ==
+                    false))
+    return ekonParseErrorLen(errMessage, s, len, *index);
+  *outKeyLen = *index - *outStart - 1;
+  if (outHash != NULL)
+    *outHash = ekonHashmapHash(s + *outStart, *outKeyLen);
+  return true;
+}
+
+// -------------- key table ----------------
+
+// a key of a key table
+typedef struct {
+  const char *key;
+  u32 len;
+  u32 hash; // ekonHashmapHash of the key
+} EkonKeySym;
+
+// interned object keys - see ekonKeyTableNew
+struct _EkonKeyTable {
+  EkonAllocator *a; // the table and the bytes of the keys
+  u32 *slots;       // id of the key in each slot, 0 for a free one
+  u32 tableSize;    // number of slots, a power of 2 and twice maxKeys at least
+  EkonKeySym *syms; // the keys, by id - 1
+  u32 size;
+  u32 maxKeys;
+  bool isFrozen;
+};
+
+EkonKeyTable *ekonKeyTableNew(u32 maxKeys) {
+  if (maxKeys > (1U << 28))
+    return 0;
+  EkonKeyTable *t = (EkonKeyTable *)ekonNew(sizeof(EkonKeyTable));
+  if (EKON_UNLIKELY(t == 0))
+    return 0;
+  t->a = ekonAllocatorNew();
+  if (EKON_UNLIKELY(t->a == 0)) {
+    ekonFree((void *)t);
+    return 0;
+  }
+  // at most half of the slots are taken, which keeps the probes short
+  t->tableSize = 16;
+  while (t->tableSize < maxKeys * 2)
+    t->tableSize *= 2;
+  t->slots = (u32 *)ekonAllocatorAlloc(t->a, t->tableSize * sizeof(u32));
+  t->syms =
+      (EkonKeySym *)ekonAllocatorAlloc(t->a, (maxKeys + 1) * sizeof(EkonKeySym));
+  if (EKON_UNLIKELY(t->slots == 0 || t->syms == 0)) {
+    ekonKeyTableRelease(t);
+    return 0;
+  }
+  memset(t->slots, 0, t->tableSize * sizeof(u32));
+  t->size = 0;
+  t->maxKeys = maxKeys;
+  t->isFrozen = false;
+  return t;
+}
+
+/**
+ * @brief find the slot of a key in a key table
+ * @param t             key table
+ * @param key           key
+ * @param len           length of the key
+ * @param hash          ekonHashmapHash of the key
+ * @return              the slot of the key, or the free slot it would go to
+ * */
+u32 ekonKeyTableSlot(const EkonKeyTable *t, const char *key, const u32 len,
+                     const u32 hash) {
+  const u32 mask = t->tableSize - 1;
+  u32 i = hash & mask;
+  for (;; i = (i + 1) & mask) {
+    const u32 id = t->slots[i];
+    if (id == 0)
+      return i;
+    const EkonKeySym *sym = t->syms + id - 1;
+    if (sym->hash == hash && sym->len == len &&
+        memcmp(sym->key, key, len) == 0)
+      return i;
+  }
+}
+
+/**
+ * @brief find a key in a key table, and add it when the table learns keys
+ * @param t             key table
+ * @param key           key. set to the bytes of the table when it is found
+ * @param len           length of the key
+ * @param hash          ekonHashmapHash of the key
+ * @return              id of the key, 0 if it is not in the table
+ * */
+u32 ekonKeyTableIntern(EkonKeyTable *t, const char **key, const u32 len,
+                       const u32 hash) {
+  const u32 i = ekonKeyTableSlot(t, *key, len, hash);
+  u32 id = t->slots[i];
+  if (id == 0) {
+    if (t->isFrozen || t->size == t->maxKeys)
+      return 0;
+    char *k = ekonAllocatorAlloc(t->a, len);
+    if (EKON_UNLIKELY(k == 0 && len != 0))
+      return 0;
+    memcpy(k, *key, len);
+    EkonKeySym *sym = t->syms + t->size;
+    sym->key = k;
+    sym->len = len;
+    sym->hash = hash;
+    id = t->slots[i] = ++t->size;
+  }
+  *key = t->syms[id - 1].key;
+  return id;
+}
+
+u32 ekonKeyTableAdd(EkonKeyTable *t, const char *key, u32 len) {
+  return ekonKeyTableIntern(t, &key, len, ekonHashmapHash(key, len));
+}
+
+u32 ekonKeyTableFind(const EkonKeyTable *t, const char *key, u32 len) {
+  return t->slots[ekonKeyTableSlot(t, key, len, ekonHashmapHash(key, len))];
+}
+
+u32 ekonKeyTableAddKeys(EkonKeyTable *t, const EkonValue *v) {
+  EkonNode *const root = v->n;
+  EkonNode *n = root;
+  while (n != 0) {
+    if (n->key != 0)
+      ekonKeyTableAdd(t, n->key, n->keyLen);
+    if ((n->ekonType == EKON_TYPE_OBJECT || n->ekonType == EKON_TYPE_ARRAY) &&
+        n->value.node != 0) {
+      n = n->value.node;
+      continue;
     }
-  } else {
-    char quoteType = s[*index];
-    if (quoteType == '"')
-      *option |= EKON_IS_KEY_ESCAPABLE;
+    while (n != root && n->next == 0)
+      n = n->father;
+    n = n == root ? 0 : n->next;
+  }
+  return t->size;
+}
 
-    u32 start = ++(*index);
-    const char *key = s + start;
+void ekonKeyTableFreeze(EkonKeyTable *t) { t->isFrozen = true; }
 
-    if (EKON_UNLIKELY(ekonUnlikelyConsume(quoteType, s, index))) {
-      return ekonEmptyKeyError(errMessage, s, *index);
-    } else {
-      if (EKON_UNLIKELY(ekonConsumeStr(s, index, quoteType, option) == false)) {
-        return ekonParseError(errMessage, s, *index);
-      }
+void ekonKeyTableRelease(EkonKeyTable *t) {
+  ekonAllocatorRelease(t->a);
+  ekonFree((void *)t);
+}
 
-      u32 keyLen = *index - start - 1;
-      if (ekonHashmapGet(keymap, key, keyLen) != NULL) {
-        ekonDuplicateKeyError(errMessage, key, *index, keyLen);
-        return false;
-      } else {
-        node->key = key;
-        node->keyLen = keyLen;
-        node->option = ekonValueOptionStrToKey(*option);
-        EkonHashmapItem **item =
-            (EkonHashmapItem **)(malloc(sizeof(EkonHashmapItem *)));
-        ekonHashmapPut(a, keymap, key, keyLen, NULL, item);
-        node->hashItem = *item;
+void ekonAllocatorSetKeyTable(EkonAllocator *a, EkonKeyTable *t) {
+  a->keys = t;
+}
+
+#ifndef EKON_KEYMAP_MIN_KEYS
+// objects with fewer keys have no keymap. their members are searched one by
+// one, which takes no memory and, at this size, no more time than hashing
+#define EKON_KEYMAP_MIN_KEYS 8
+#endif
+
+#ifndef EKON_KEYTABLE_SCAN_KEYS
+// objects parsed with a key table are checked for duplicate keys without a
+// keymap up to this many keys, as long as their keys are interned: those
+// compare by address
+#define EKON_KEYTABLE_SCAN_KEYS 32
+#endif
+
+/**
+ * @brief build a keymap of the members of an object, from `last` back to the
+ *        first one. for a key that repeats, the later member is kept
+ * @param a             allocator of the object
+ * @param last          last member to index
+ * @param size          number of keys to make room for
+ * @return              the keymap, NULL if out of memory
+ * */
+EkonHashmap *ekonNodeKeymapNew(EkonAllocator *a, EkonNode *last, u32 size) {
+  EkonHashmap *map = (EkonHashmap *)ekonAllocatorAlloc(a, sizeof(EkonHashmap));
+  if (EKON_UNLIKELY(map == 0 || ekonHashmapInit(a, size, map) == false))
+    return 0;
+  for (EkonNode *n = last; n != 0; n = n->prev) {
+    if (ekonHashmapGet(map, n->key, n->keyLen, n->keyHash) != NULL) {
+      n->hashItem = NULL;
+      map->shadowed++;
+      continue;
+    }
+    if (EKON_UNLIKELY(ekonHashmapPut(a, map, n->key, n->keyLen, n->keyHash, n,
+                                     &n->hashItem) == false))
+      return 0;
+  }
+  return map;
+}
+
+/**
+ * @brief find the member of an object with a key. the keymap of an object
+ *        with EKON_KEYMAP_MIN_KEYS keys is built here if it has none yet
+ * @param a             allocator of the object
+ * @param obj           object node
+ * @param key           key to look for
+ * @param keyLen        length of the key
+ * @return              the member, NULL if not found
+ * */
+EkonNode *ekonNodeObjFind(EkonAllocator *a, EkonNode *obj, const char *key,
+                          const u32 keyLen) {
+  if (EKON_UNLIKELY(obj->value.node == 0))
+    return NULL;
+  if (obj->keymap == 0 && obj->len >= EKON_KEYMAP_MIN_KEYS)
+    obj->keymap = ekonNodeKeymapNew(a, obj->end, obj->len);
+  if (obj->keymap != 0)
+    return ekonHashmapGet(obj->keymap, key, keyLen,
+                          ekonHashmapHash(key, keyLen));
+  for (EkonNode *n = obj->end; n != 0; n = n->prev)
+    if (n->keyLen == keyLen && memcmp(n->key, key, keyLen) == 0)
+      return n;
+  return NULL;
+}
+
+/**
+ * @brief ekonNodeObjFind with the hash of the key already known. members
+ *        are told apart by their hashes before their keys
+ * @param a             allocator of the object
+ * @param obj           object node
+ * @param key           key to look for
+ * @param keyLen        length of the key
+ * @param hash          ekonHashmapHash of the key
+ * @return              the member, NULL if not found
+ * */
+EkonNode *ekonNodeObjFindHashed(EkonAllocator *a, EkonNode *obj,
+                                const char *key, const u32 keyLen,
+                                const u32 hash) {
+  if (EKON_UNLIKELY(obj->value.node == 0))
+    return NULL;
+  if (obj->keymap == 0 && obj->len >= EKON_KEYMAP_MIN_KEYS)
+    obj->keymap = ekonNodeKeymapNew(a, obj->end, obj->len);
+  if (obj->keymap != 0)
+    return ekonHashmapGet(obj->keymap, key, keyLen, hash);
+  for (EkonNode *n = obj->end; n != 0; n = n->prev)
+    if (n->keyHash == hash && n->keyLen == keyLen &&
+        (n->key == key || memcmp(n->key, key, keyLen) == 0))
+      return n;
+  return NULL;
+}
+
+/**
+ * @brief index a member just appended to an object or renamed, if the object
+ *        has a keymap. without one, it is built from the members when needed.
+ *        of the members with the same key, the last one is indexed
+ * @param a             allocator of the object
+ * @param obj           object node
+ * @param member        new member, with its key set
+ * @return              false if out of memory
+ * */
+bool ekonNodeKeymapAdd(EkonAllocator *a, EkonNode *obj, EkonNode *member) {
+  EkonHashmap *const map = obj->keymap;
+  member->hashItem = NULL;
+  if (map == 0)
+    return true;
+  EkonNode *const other =
+      ekonHashmapGet(map, member->key, member->keyLen, member->keyHash);
+  if (EKON_UNLIKELY(other != NULL)) {
+    map->shadowed++;
+    // a renamed member may come before the one it takes the key of
+    for (EkonNode *n = member->next; n != 0; n = n->next)
+      if (n == other)
+        return true;
+    other->hashItem = NULL;
+  }
+  return ekonHashmapPut(a, map, member->key, member->keyLen, member->keyHash,
+                        member, &member->hashItem);
+}
+
+/**
+ * @brief drop a member that leaves an object from the keymap of the object.
+ *        if it hid an earlier member with the same key, that one is indexed
+ *        in its place
+ * @param obj           object node
+ * @param member        member being removed
+ * */
+void ekonNodeKeymapRemove(EkonNode *obj, EkonNode *member) {
+  EkonHashmap *const map = obj->keymap;
+  member->hashItem = NULL;
+  if (map == 0)
+    return;
+  const u32 index =
+      ekonHashmapFind(map, member->key, member->keyLen, member->keyHash);
+  if (EKON_UNLIKELY(index == map->tableSize))
+    return;
+  EkonHashmapItem *const e = &map->data[index];
+  if (EKON_UNLIKELY(e->value != member)) {
+    // a member that was hidden itself
+    map->shadowed--;
+    return;
+  }
+  // only looked for when the object has repeated keys at all. `member` may
+  // already be out of the list of members
+  if (EKON_UNLIKELY(map->shadowed != 0)) {
+    for (EkonNode *n = obj->end; n != 0; n = n->prev) {
+      if (n != member && n->keyHash == member->keyHash &&
+          n->keyLen == member->keyLen &&
+          memcmp(n->key, member->key, n->keyLen) == 0) {
+        map->shadowed--;
+        e->value = n;
+        e->key = n->key;
+        n->hashItem = e;
+        return;
       }
     }
   }
+  ekonHashmapErase(map, index);
+}
+
+/**
+ * @brief set the key of a node, and move it in the keymap of its object
+ * @param a             allocator of the node
+ * @param n             node to rename
+ * @param key           new key
+ * @param keyLen        length of the key
+ * @return              false if out of memory
+ * */
+bool ekonNodeSetKey(EkonAllocator *a, EkonNode *n, const char *key,
+                    const u32 keyLen) {
+  EkonNode *father = n->father;
+  const bool isMember = father != 0 && father->ekonType == EKON_TYPE_OBJECT;
+  if (isMember && n->key != 0)
+    ekonNodeKeymapRemove(father, n);
+  n->key = key;
+  n->keyLen = keyLen;
+  n->keyHash = ekonHashmapHash(key, keyLen);
+  n->keyId = 0;
+  if (isMember)
+    return ekonNodeKeymapAdd(a, father, n);
   return true;
 }
 
-bool ekonValueParseFast(EkonValue *v, const char *s, char **errMessage,
-                        char **schema) {
-  if (EKON_UNLIKELY(s[0] == '\0')) {
-    ekonParseError(errMessage, s, 0);
+/**
+ * @brief add a key to the node
+ * @param a             EkonAllocator where the memory allocation happens
+ * @param node          EkonNode where the key is to be added
+ * @param s             Ekon string which is to be parsed
+ * @param len           length of the source
+ * @param index         index to be updated
+ * @param option        key options (EKON_NODE_OPTIONS)
+ * @param isTrusted     the key is not checked against the other members,
+ *                      see EkonParseOptions.allowDuplicateKeys
+ * @param errMessage    errMessage where the error message is to be stored
+ * @return              success/failure
+ * */
+bool ekonNodeAddKey(EkonAllocator *a, EkonNode *node, const char *s,
+                    const u32 len, u32 *index, EkonOption *option,
+                    const bool isTrusted, char **errMessage) {
+  EkonNode *father = node->father;
+  const bool isKeyQuoted = ekonIsQuote(ekonCharAt(s, len, *index));
+  u32 start, keyLen, hash;
+  if (ekonConsumeKey(s, len, index, &start, &keyLen, &hash, option,
+                     errMessage) == false)
     return false;
+
+  // `node` is the last member and already counted in father->len
+  const char *key = s + start;
+  node->option = isKeyQuoted ? ekonValueOptionStrToKey(*option) : *option;
+  // an interned key points to the table, so it is the same address as the
+  // other members with the same key
+  node->keyId = a->keys != 0 ? ekonKeyTableIntern(a->keys, &key, keyLen, hash)
+                             : 0;
+  // the object gets its keymap on its first lookup
+  if (isTrusted) {
+    node->key = key;
+    node->keyLen = keyLen;
+    node->keyHash = hash;
+    node->hashItem = NULL;
+    return true;
+  }
+  if (EKON_LIKELY(father->keymap == 0)) {
+    // a member with the same key parsed before this one was interned too
+    if (node->keyId != 0 && father->len < EKON_KEYTABLE_SCAN_KEYS) {
+      for (EkonNode *n = node->prev; n != 0; n = n->prev)
+        if (n->key == key)
+          return ekonDuplicateKeyError(errMessage, s, start, keyLen);
+      node->key = key;
+      node->keyLen = keyLen;
+      node->keyHash = hash;
+      node->hashItem = NULL;
+      return true;
+    }
+    if (father->len < EKON_KEYMAP_MIN_KEYS) {
+      for (EkonNode *n = node->prev; n != 0; n = n->prev)
+        if (n->keyHash == hash && n->keyLen == keyLen &&
+            (n->key == key || memcmp(n->key, key, keyLen) == 0))
+          return ekonDuplicateKeyError(errMessage, s, start, keyLen);
+      node->key = key;
+      node->keyLen = keyLen;
+      node->keyHash = hash;
+      node->hashItem = NULL;
+      return true;
+    }
+    father->keymap = ekonNodeKeymapNew(a, node->prev, father->len);
+    if (EKON_UNLIKELY(father->keymap == 0))
+      return false;
   }
 
-  EkonNode *srcNode;
+  if (ekonHashmapGet(father->keymap, key, keyLen, hash) != NULL)
+    return ekonDuplicateKeyError(errMessage, s, start, keyLen);
+  node->key = key;
+  node->keyLen = keyLen;
+  node->keyHash = hash;
+  return ekonHashmapPut(a, father->keymap, key, keyLen, hash, node,
+                        &node->hashItem);
+}
+
+/**
+ * @brief open the array or object whose bracket has just been consumed. an
+ *        empty one is closed right away, otherwise `node` moves on to its
+ *        first child and index is left at the first char of it
+ * @param node          node of the array/object. updated
+ * @param v             main value, the allocator is relevant
+ * @param srcNode       node `v` had before parsing, restored on errors
+ * @param s             EKON string
+ * @param len           length of the source
+ * @param index         index right after the bracket. updated
+ * @param st            structural index or NULL
+ * @param errMessage    errMessage where the error message is to be stored
+ * @param addObjOpt     (EKON_OPT_IS_OBJ | EKON_OPT_IS_ROOT_OBJ)
+ * @return              success/failure
+ * */
+bool ekonParseContainer(EkonNode **node, EkonValue *v, EkonNode *srcNode,
+                        const char *s, const u32 len, u32 *index,
+                        EkonStructurals *st, char **errMessage,
+                        const EkonNodeOpt addObjOpt) {
+  EkonNode *currNode = *node;
+  if (ekonNodeAddObjOrArrNode(node, v, srcNode, s, len, index, st, errMessage,
+                              addObjOpt) == false)
+    return false;
+
+  if (currNode == *node)
+    return true;
+
+  const char nextChar = ekonPeek(s, len, index, st);
+  if (nextChar == ',' ||
+      (nextChar == ':' && (addObjOpt & EKON_OPT_IS_OBJ) != 0))
+    return ekonParseErrorLen(errMessage, s, len, *index);
+
+  (*index)--;
+  return true;
+}
+
+/**
+ * @brief parse `null`, `true`, `false` or an unquoted string starting with
+ *        one of their letters
+ * @param node      node to be filled in
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index right after the first letter. updated
+ * @param c         the first letter
+ * @param option    options collected for the node so far
+ * @return          success/failure
+ * */
+bool ekonParseKeyword(EkonNode *node, const char *s, const u32 len, u32 *index,
+                      const char c, EkonOption option) {
+  const u32 start = *index - 1;
+  const u32 keywordLen = ekonMatchKeyword(s, len, start, c);
+  if (EKON_LIKELY(keywordLen != 0)) {
+    *index = start + keywordLen;
+    if (c == 'n')
+      ekonNodeAddNull(node);
+    else
+      ekonNodeAddBoolean(node, c == 't');
+    return true;
+  }
+
+  // `nullable`, `trueish`, ... are unquoted strings. nothing past the first
+  // letter has been consumed, so the scan just carries on from there
+  if (ekonConsumeUnquotedStr(s, len, index)) {
+    option &= ~EKON_IS_STR_MULTILINED;
+    option &= ~EKON_IS_STR_SPACED;
+    ekonNodeAddStr(node, s + start, *index - start, option);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief parse a quoted string
+ * @param node      node to be filled in
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index right after the opening quote. updated
+ * @param c         the opening quote
+ * @param option    options collected for the node so far. updated
+ * @return          success/failure
+ * */
+bool ekonParseString(EkonNode *node, const char *s, const u32 len, u32 *index,
+                     const char c, EkonOption *option) {
+  const u32 start = *index;
+  if (c == '"')
+    *option |= EKON_IS_STR_ESCAPABLE;
+
+  if (EKON_UNLIKELY(ekonUnlikelyConsume(c, s, len, index))) {
+    *option |= EKON_IS_STR_SPACED;
+    *option &= ~EKON_IS_STR_MULTILINED;
+    ekonNodeAddStr(node, s + *index, 0, *option);
+    return true;
+  }
+
+  if (EKON_LIKELY(ekonConsumeStr(s, len, index, c, option))) {
+    ekonNodeAddStr(node, s + start, *index - start - 1, *option);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief parse an unquoted string
+ * @param node      node to be filled in
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index of the first char. updated
+ * @return          success/failure
+ * */
+bool ekonParseUnquoted(EkonNode *node, const char *s, const u32 len,
+                       u32 *index) {
+  const u32 start = *index;
+  if (ekonConsumeUnquotedStr(s, len, index)) {
+    ekonNodeAddStr(node, s + start, *index - start, 0);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @brief parse a number, or an unquoted string that only starts like one
+ * @param node      node to be filled in
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index right after the first char. updated
+ * @return          success/failure
+ * */
+bool ekonParseNumber(EkonNode *node, const char *s, const u32 len,
+                     u32 *index) {
+  const u32 start = --(*index);
+  EkonOption numOption = 0;
+  if (ekonConsumeNum(s, len, index, &numOption)) {
+    ekonNodeAddNumber(node, s + start, *index - start, numOption);
+    return true;
+  }
+  // not a number after all, e.g. `1st`
+  *index = start;
+  return ekonParseUnquoted(node, s, len, index);
+}
 
+/**
+ * @brief set up the root node of `v` for a parse
+ * @param v         value to parse into. a node it already has is reused
+ * @param srcNode   copy of that node, restored on errors. 0 for a new node
+ * @return          false if out of memory
+ * */
+bool ekonValueParseBegin(EkonValue *v, EkonNode **srcNode) {
   if (EKON_LIKELY(v->n == 0)) {
     v->n = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
-    if (EKON_UNLIKELY(v->n == 0)) {
-      ekonParseError(errMessage, s, 0);
+    if (EKON_UNLIKELY(v->n == 0))
       return false;
-    }
     v->n->prev = 0;
     v->n->next = 0;
     v->n->father = 0;
     v->n->key = 0;
-    srcNode = 0;
+    *srcNode = 0;
   } else {
-    srcNode = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
-    if (EKON_UNLIKELY(srcNode == 0)) {
-      ekonParseError(errMessage, s, 0);
+    *srcNode = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
+    if (EKON_UNLIKELY(*srcNode == 0))
       return false;
-    }
-    *srcNode = *v->n;
+    **srcNode = *v->n;
+  }
+  return true;
+}
+
+/**
+ * @brief the parser behind ekonValueParseLen and ekonValueParseEx
+ * @param v             value to parse into
+ * @param s             EKON string
+ * @param len           length of the source
+ * @param o             options
+ * @param errMessage    errMessage where the error message is to be stored
+ * @param schema        where the schema is copied to, NULL to skip it
+ * @return              success/failure
+ * */
+bool ekonValueParseOpt(EkonValue *v, const char *s, u32 len,
+                       const EkonParseOptions *o, char **errMessage,
+                       char **schema) {
+  if (EKON_UNLIKELY(len == 0 || (o->maxLen != 0 && len > o->maxLen))) {
+    ekonParseErrorLen(errMessage, s, len, 0);
+    return false;
+  }
+  // the limits, counted down while parsing
+  u32 depthLeft = o->maxDepth != 0 ? o->maxDepth : UINT32_MAX;
+  u32 valuesLeft = o->maxValues != 0 ? o->maxValues : UINT32_MAX;
+  const bool isTrusted = o->allowDuplicateKeys;
+  const bool isEager = o->numbers == EKON_NUMBERS_EAGER;
+
+  EkonNode *srcNode;
+  if (EKON_UNLIKELY(ekonValueParseBegin(v, &srcNode) == false))
+    return ekonParseErrorLen(errMessage, s, len, 0);
+
+  // large sources get a structural index to skip whitespace and comments
+  EkonStructurals structurals, *st = NULL;
+  if (len >= EKON_STRUCTURAL_MIN_LEN) {
+    ekonStructuralsInit(&structurals, s, len);
+    st = &structurals;
   }
 
   u32 index = 0;
   EkonNode *node = v->n;
   bool isRootNoCurlyBrace = false;
-  char c = ekonPeek(s, &index);
+  char c = ekonPeek(s, len, &index, st);
 
   if (c == '`') {
     const u32 start = index;
-    if (ekonConsumeSchema(s, &index) == false)
-      return ekonParseError(errMessage, s, index);
+    if (ekonConsumeSchema(s, len, &index) == false)
+      return ekonParseErrorLen(errMessage, s, len, index);
 
-    if (*schema == NULL)
+    if (schema != NULL && *schema == NULL)
       *schema = ekonCopySchema(s + start, index - start - 1);
 
-    c = ekonPeek(s, &index);
+    // the schema is not EKON. index the rest of the source from scratch
+    if (st != NULL)
+      ekonStructuralsInit(st, s, len);
+
+    c = ekonPeek(s, len, &index, st);
   }
 
   const u32 ifRootStart = index - 1;
+  bool isRoot = true;
 
-  switch (c) {
-  case '[': {
-    if (ekonNodeAddObjOrArrNode(&node, v, srcNode, s, &index, errMessage,
-                                (const EkonNodeOpt)0))
-      break;
-    return false;
-  }
-  case '{': {
-    if (ekonNodeAddObjOrArrNode(&node, v, srcNode, s, &index, errMessage,
-                                EKON_OPT_IS_OBJ))
-      break;
-    return false;
-  }
-  case 'n': {
-    u32 start = index - 1;
-    if (EKON_LIKELY(ekonConsumeNull(s, &index))) {
-      if (ekonIsNonUnquotedStrChar(s[index])) {
-        ekonNodeAddNull(node);
-        break;
-      }
-      if (ekonConsumeUnquotedStr(s, &index)) {
-        u32 strEnd = index;
-        if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-          isRootNoCurlyBrace = true;
-          index = ifRootStart;
-          break;
-        }
-        ekonNodeAddStr(node, s + start, strEnd - start, (EKON_NODE_OPTIONS)0);
-        break;
+  do {
+    EkonOption option = 0;
+    const bool atRoot = isRoot;
+    isRoot = false;
+
+    // the root value was peeked above
+    if (EKON_LIKELY(atRoot == false)) {
+      if (node->father->ekonType == EKON_TYPE_OBJECT) {
+        if (ekonNodeAddKey(v->a, node, s, len, &index, &option, isTrusted,
+                           errMessage) == 0)
+          return false;
+
+        if (EKON_UNLIKELY(ekonLikelyPeekAndConsume(':', s, len, &index, st) ==
+                          false))
+          return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+      } else {
+        node->key = 0;
       }
+      c = ekonPeek(s, len, &index, st);
     }
-    if (ekonConsumeUnquotedStr(s, &index)) {
-      u32 strEnd = index;
-      if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-        isRootNoCurlyBrace = true;
-        index = ifRootStart;
-        break;
-      }
-      ekonNodeAddStr(node, s + start, strEnd - start, (EKON_NODE_OPTIONS)0);
-      break;
+
+#if defined(EKON_COMPUTED_GOTO)
+    static const void *const dispatch[] = {&&parseOther,   &&parseArray,
+                                           &&parseObject,  &&parseKeyword,
+                                           &&parseString,  &&parseNumber};
+    goto *dispatch[ekonClass(c) & EKON_CHAR_TOKEN];
+#else
+    switch ((EkonToken)(ekonClass(c) & EKON_CHAR_TOKEN)) {
+    case EKON_TOKEN_ARRAY:
+      goto parseArray;
+    case EKON_TOKEN_OBJECT:
+      goto parseObject;
+    case EKON_TOKEN_KEYWORD:
+      goto parseKeyword;
+    case EKON_TOKEN_STRING:
+      goto parseString;
+    case EKON_TOKEN_NUMBER:
+      goto parseNumber;
+    default:
+      goto parseOther;
     }
-    return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-  }
-  case 'f': {
-    u32 start = index - 1;
-    if (EKON_LIKELY(ekonConsumeFalse(s, &index))) {
-      if (ekonIsNonUnquotedStrChar(s[index])) {
-        ekonNodeAddBoolean(node, false);
-        break;
+#endif
+
+  parseArray:
+  parseObject : {
+    EkonNode *currNode = node;
+    if (EKON_UNLIKELY(depthLeft == 0))
+      return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+    if (ekonParseContainer(&node, v, srcNode, s, len, &index, st, errMessage,
+                           (const EkonNodeOpt)(c == '{' ? EKON_OPT_IS_OBJ
+                                                        : 0)) == false)
+      return false;
+
+    if (currNode == node)
+      goto parsedValue;
+    depthLeft--;
+    if (EKON_UNLIKELY(valuesLeft-- == 0))
+      return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+    continue;
+  }
+  parseKeyword : {
+    if (EKON_LIKELY(ekonParseKeyword(node, s, len, &index, c, option)))
+      goto parsedScalar;
+    return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+  }
+  parseString : {
+    if (EKON_LIKELY(ekonParseString(node, s, len, &index, c, &option)))
+      goto parsedScalar;
+    return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+  }
+  parseNumber : {
+    if (EKON_LIKELY(ekonParseNumber(node, s, len, &index)) &&
+        (isEager == false || node->ekonType != EKON_TYPE_NUMBER ||
+         ekonNodeNum(node)))
+      goto parsedScalar;
+    return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+  }
+  parseOther : {
+    if (c == ',')
+      return ekonParseErrorLen(errMessage, s, len, index);
+    index--;
+    if (ekonParseUnquoted(node, s, len, &index))
+      goto parsedScalar;
+    return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+  }
+
+  parsedScalar:
+    // a root scalar followed by ':' is the first key of an object without
+    // curly braces
+    if (EKON_UNLIKELY(atRoot) &&
+        ekonUnlikelyPeekAndConsume(':', s, len, &index, st)) {
+      isRootNoCurlyBrace = true;
+      index = ifRootStart;
+      if (EKON_UNLIKELY(depthLeft-- == 0 || valuesLeft-- == 0))
+        return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+      if (ekonNodeAddObjOrArrNode(
+              &node, v, srcNode, s, len, &index, st, errMessage,
+              (const EkonNodeOpt)(EKON_OPT_IS_OBJ | EKON_OPT_IS_ROOT_OBJ)) ==
+          false)
+        return false;
+      continue;
+    }
+
+  parsedValue:
+    while (EKON_LIKELY(node != v->n)) {
+      char c = ekonPeek(s, len, &index, st);
+      if (c == ',')
+        c = ekonPeek(s, len, &index, st);
+
+      if (c == ',') {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return false;
       }
-      if (ekonConsumeUnquotedStr(s, &index)) {
-        u32 strEnd = index;
-        if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-          isRootNoCurlyBrace = true;
-          index = ifRootStart;
-          break;
+
+      if (c == 0) {
+        if (isRootNoCurlyBrace) {
+          node->next = 0;
+          return true;
+        } else {
+          ekonParseErrorLen(errMessage, s, len, index);
+          return false;
         }
-        ekonNodeAddStr(node, s + start, strEnd - start, (EKON_NODE_OPTIONS)0);
-        break;
       }
-    }
-    if (ekonConsumeUnquotedStr(s, &index)) {
-      u32 strEnd = index;
-      if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-        isRootNoCurlyBrace = true;
-        index = ifRootStart;
+
+      if (c == ':') {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return false;
+      }
+
+      if (c == '}' || c == ']') {
+        if (c == '}') {
+          if (node->father->ekonType == EKON_TYPE_OBJECT) {
+            node->next = 0;
+            node = node->father;
+            depthLeft++;
+          }
+        } else {
+          if (node->father->ekonType == EKON_TYPE_ARRAY) {
+            node->next = 0;
+            node = node->father;
+            depthLeft++;
+          }
+        }
+      } else {
+        EkonNode *n = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
+
+        if (EKON_UNLIKELY(n == 0 || valuesLeft-- == 0))
+          return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+
+        n->father = node->father;
+        n->prev = node;
+
+        node->father->end = n;
+        ++(node->father->len);
+        node->next = n;
+        node = n;
+        index--;
         break;
       }
-      ekonNodeAddStr(node, s + start, strEnd - start, (EKON_NODE_OPTIONS)0);
+    }
+  } while (EKON_LIKELY(node != v->n));
+
+  if (EKON_LIKELY(ekonLikelyPeekAndConsume(0, s, len, &index, st)))
+    return true;
+
+  return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+}
+
+// parses with the defaults of EkonParseOptions
+static const EkonParseOptions ekonParseDefaults = {false, false, 0, 0, 0,
+                                                   EKON_NUMBERS_LAZY};
+
+bool ekonValueParseLen(EkonValue *v, const char *s, u32 len, char **errMessage,
+                       char **schema) {
+  return ekonValueParseOpt(v, s, len, &ekonParseDefaults, errMessage, schema);
+}
+
+bool ekonValueParseEx(EkonValue *v, const char *s, u32 len,
+                      const EkonParseOptions *options, char **errMessage,
+                      char **schema) {
+  if (options == NULL)
+    options = &ekonParseDefaults;
+  return ekonValueParseOpt(v, s, len, options,
+                           errMessage, options->skipSchema ? NULL : schema);
+}
+
+// ekon parse - API
+bool ekonValueParseFast(EkonValue *v, const char *s, char **err,
+                        char **schema) {
+  return ekonValueParseLen(v, s, ekonStrLen(s), err, schema);
+}
+
+// The main parser - API
+bool ekonValueParse(EkonValue *v, const char *s, char **err, char **schema) {
+  return ekonValueParseLen(v, s, ekonStrLen(s), err, schema);
+}
+
+// -------------- incremental parser ----------------
+
+// where an EkonParser stands in the source
+typedef enum {
+  EKON_PARSER_START,      // before the schema and the root value
+  EKON_PARSER_VALUE,      // before a value
+  EKON_PARSER_KEY,        // at the first char of a key or an array element
+  EKON_PARSER_COLON,      // after a key
+  EKON_PARSER_OPEN,       // after '[' or '{'
+  EKON_PARSER_NEXT,       // after a value
+  EKON_PARSER_COMMA,      // after the ',' that follows a value
+  EKON_PARSER_ROOT_COLON, // after a root scalar, which may be the first key
+  EKON_PARSER_END,        // after the root value
+  EKON_PARSER_DONE,
+  EKON_PARSER_FAILED
+} EkonParserState;
+
+// the tree builder state of ekonValueParseLen, kept between chunks
+struct _EkonParser {
+  EkonValue *v;
+  EkonNode *node;    // node being parsed
+  EkonNode *srcNode; // node `v` had before, restored on errors
+  char *buf;         // window: the unparsed tail of the chunks so far
+  u32 len;           // bytes in buf
+  u32 size;          // capacity of buf, EKON_PADDING not included
+  u32 index;         // parse position in buf
+  u32 scan;          // how far the look ahead for the current token got
+  u32 rootStart;     // a root scalar may still turn out to be the first key
+  u32 line;          // line and column of buf[0] in the whole source
+  u32 col;
+  u32 total; // bytes fed so far
+  EkonOption option;
+  EkonParserState state;
+  char open; // bracket consumed before EKON_PARSER_OPEN
+  bool isRoot;
+  bool isRootNoCurlyBrace;
+};
+
+EkonParser *ekonParserNew(EkonValue *v) {
+  EkonParser *p = (EkonParser *)ekonAllocatorAlloc(v->a, sizeof(EkonParser));
+  if (EKON_UNLIKELY(p == 0))
+    return 0;
+  memset(p, 0, sizeof(EkonParser));
+  if (EKON_UNLIKELY(ekonValueParseBegin(v, &p->srcNode) == false))
+    return 0;
+  p->v = v;
+  p->node = v->n;
+  p->line = 1;
+  p->state = EKON_PARSER_START;
+  return p;
+}
+
+/**
+ * @brief append a chunk to the window. nodes point into the window, so it is
+ *        never moved: when it is full, the bytes that are not parsed yet move
+ *        to a new one of at least twice their size
+ * @param p         parser
+ * @param chunk     bytes to append
+ * @param len       length of the chunk
+ * @return          false if out of memory
+ * */
+bool ekonParserAppend(EkonParser *p, const char *chunk, const u32 len) {
+  if (EKON_LIKELY(p->size - p->len >= len)) {
+    memcpy(p->buf + p->len, chunk, len);
+    p->len += len;
+    return true;
+  }
+
+  // a root scalar is re-read as a key if a ':' follows it
+  const u32 keep =
+      p->state == EKON_PARSER_ROOT_COLON ? p->rootStart : p->index;
+  const u32 carry = p->len - keep;
+  u32 size = ekonAllocatorInitMemSize;
+  while (size < 2 * (carry + len) && size < 0x80000000U)
+    size *= 2;
+  if (EKON_UNLIKELY(size < carry + len))
+    return false;
+  char *buf = ekonAllocatorAlloc(p->v->a, (size + EKON_PADDING + 7) & ~7U);
+  if (EKON_UNLIKELY(buf == 0))
+    return false;
+
+  // error messages count lines from the start of the source
+  for (u32 i = 0; i < keep; i++) {
+    if (p->buf[i] == '\n') {
+      p->line++;
+      p->col = 0;
+    } else {
+      p->col++;
+    }
+  }
+
+  if (carry != 0)
+    memcpy(buf, p->buf + keep, carry);
+  memcpy(buf + carry, chunk, len);
+  p->buf = buf;
+  p->len = carry + len;
+  p->size = size;
+  p->index -= keep;
+  p->rootStart = p->rootStart > keep ? p->rootStart - keep : 0;
+  p->scan = p->scan > keep ? p->scan - keep : 0;
+  return true;
+}
+
+/**
+ * @brief move p->index past whitespace and comments
+ * @param p         parser
+ * @param isLast    the window ends the source
+ * @return          false if more of the source is to come and the window ends
+ *                  first, in a comment or right after the next char. error
+ *                  messages show the char before the error, or 0 at the end of
+ *                  the source, so the byte after a token has to be known too
+ * */
+bool ekonParserSkip(EkonParser *p, const bool isLast) {
+  const char *s = p->buf;
+  u32 index = ekonSkipWhiteSpace(s, p->len, p->index);
+  while (index + 1 < p->len && s[index] == '/' && s[index + 1] == '/') {
+    const char *nl =
+        (const char *)memchr(s + index + 2, '\n', p->len - index - 2);
+    if (nl == NULL)
       break;
+    index = ekonSkipWhiteSpace(s, p->len, (u32)(nl - s) + 1);
+  }
+  p->index = index;
+  return isLast || (index + 1 < p->len && s[index] != '/');
+}
+
+/**
+ * @brief look for the end of the unquoted word at `start`. resumes at p->scan
+ * @return          true if the char that ends it is in the window
+ * */
+bool ekonParserHasWord(EkonParser *p, const u32 start) {
+  u32 index = p->scan > start ? p->scan : start;
+  while (index < p->len && (ekonClass(p->buf[index]) &
+                            (EKON_CHAR_END | EKON_CHAR_CONTROL)) == 0)
+    index++;
+  p->scan = index;
+  return index < p->len;
+}
+
+/**
+ * @brief look for the end of the quoted string at `start`, so that
+ *        ekonConsumeStr can take it in one go. resumes at p->scan
+ * @return          true if it ends inside the window
+ * */
+bool ekonParserHasStr(EkonParser *p, const u32 start) {
+  const char quoteType = p->buf[start];
+  EkonOption option = 0;
+  u32 index = p->scan > start ? p->scan : start + 1;
+  for (;;) {
+    index = ekonScanStr(p->buf, p->len, index, quoteType, &option);
+    // an escape is at most 12 bytes (\uXXXX\uXXXX), plus the one after it
+    if (index < p->len && p->buf[index] == '\\' && p->len - index > 12) {
+      index += 2;
+      continue;
     }
-    return ekonSrcNodeError(srcNode, v, s, errMessage, index);
+    p->scan = index;
+    return index < p->len && p->buf[index] != '\\';
   }
-  case 't': {
-    u32 start = index - 1;
-    if (EKON_LIKELY(ekonConsumeTrue(s, &index))) {
-      if (ekonIsNonUnquotedStrChar(s[index]) == true) {
-        ekonNodeAddBoolean(node, true);
-        break;
-      }
-      if (ekonConsumeUnquotedStr(s, &index) == true) {
-        u32 strEnd = index;
-        if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-          isRootNoCurlyBrace = true;
-          index = ifRootStart;
-          break;
+}
+
+/**
+ * @brief stop the parser on an error. `v` gets back the node it had. the
+ *        "<line>:<pos>:" of the message is moved from the window to the source
+ * @return          false
+ * */
+bool ekonParserFail(EkonParser *p, char **errMessage) {
+  if (p->srcNode == 0)
+    p->v->n = 0;
+  else
+    *p->v->n = *p->srcNode;
+  p->state = EKON_PARSER_FAILED;
+
+  u32 line = 0, pos = 0;
+  int n = 0;
+  if (*errMessage == NULL || (p->line == 1 && p->col == 0) ||
+      sscanf(*errMessage, "%u:%u:%n", &line, &pos, &n) != 2 || n == 0)
+    return false;
+  if (line == 1)
+    pos += p->col;
+  line += p->line - 1;
+
+  const u32 size = ekonStrLen(*errMessage) + 24;
+  char *message = (char *)ekonNew(size);
+  snprintf(message, size, "%u:%u:%s", line, pos, *errMessage + n);
+  ekonFree(*errMessage);
+  *errMessage = message;
+  return false;
+}
+
+/**
+ * @brief run the tree builder over the window for as long as its tokens are
+ *        complete. every step first makes sure of that, then parses with the
+ *        same functions as ekonValueParseLen
+ * @param p           parser
+ * @param isLast      the window ends the source
+ * @param errMessage  pointer for the errMessage to be stored
+ * @param schema      pointer to the schema
+ * @return            false on errors
+ * */
+bool ekonParserRun(EkonParser *p, const bool isLast, char **errMessage,
+                   char **schema) {
+  EkonValue *v = p->v;
+  const char *s = p->buf;
+  const u32 len = p->len;
+  u32 index;
+  char c;
+
+  for (;;) {
+    switch (p->state) {
+    case EKON_PARSER_START: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      if (ekonCharAt(s, len, p->index) == '`') {
+        const u32 start = p->index + 1;
+        index = p->scan > start ? p->scan : start;
+        if (isLast == false && memchr(s + index, '`', len - index) == NULL) {
+          p->scan = len;
+          return true;
         }
-        ekonNodeAddStr(node, s + start, strEnd - start, (EKON_NODE_OPTIONS)0);
-        break;
+        index = start;
+        if (ekonConsumeSchema(s, len, &index) == false) {
+          ekonParseErrorLen(errMessage, s, len, index);
+          return ekonParserFail(p, errMessage);
+        }
+        if (*schema == NULL)
+          *schema = ekonCopySchema(s + start, index - start - 1);
+        p->index = index;
       }
+      p->isRoot = true;
+      p->option = 0;
+      p->state = EKON_PARSER_VALUE;
+      break;
     }
-    if (ekonConsumeUnquotedStr(s, &index)) {
-      u32 strEnd = index;
-      if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-        isRootNoCurlyBrace = true;
-        index = ifRootStart;
+    case EKON_PARSER_VALUE: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      index = p->index;
+      c = ekonPeek(s, len, &index, NULL);
+      const u32 start = index - 1;
+      const EkonToken token = (EkonToken)(ekonClass(c) & EKON_CHAR_TOKEN);
+      if (token == EKON_TOKEN_ARRAY || token == EKON_TOKEN_OBJECT) {
+        p->open = c;
+        p->isRoot = false;
+        p->index = index;
+        p->state = EKON_PARSER_OPEN;
         break;
       }
-      ekonNodeAddStr(node, s + start, strEnd - start, (EKON_NODE_OPTIONS)0);
+
+      if (isLast == false && (token == EKON_TOKEN_STRING
+                                  ? ekonParserHasStr(p, start)
+                                  : ekonParserHasWord(p, start)) == false)
+        return true;
+
+      bool ok;
+      if (token == EKON_TOKEN_KEYWORD) {
+        ok = ekonParseKeyword(p->node, s, len, &index, c, p->option);
+      } else if (token == EKON_TOKEN_STRING) {
+        ok = ekonParseString(p->node, s, len, &index, c, &p->option);
+      } else if (token == EKON_TOKEN_NUMBER) {
+        ok = ekonParseNumber(p->node, s, len, &index);
+      } else if (c == ',') {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
+      } else {
+        index--;
+        ok = ekonParseUnquoted(p->node, s, len, &index);
+      }
+      if (EKON_UNLIKELY(ok == false)) {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
+      }
+
+      if (p->isRoot) {
+        p->isRoot = false;
+        p->rootStart = start;
+        p->state = EKON_PARSER_ROOT_COLON;
+      } else {
+        p->state = EKON_PARSER_NEXT;
+      }
+      p->index = index;
       break;
     }
-    return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-  }
-  case '\'':
-  case '"': {
-    u32 start = index;
-    if (EKON_UNLIKELY(ekonUnlikelyConsume(c, s, &index))) {
-      ekonNodeAddStr(node, s + index, 0, EKON_IS_STR_SPACED);
+    case EKON_PARSER_KEY: {
+      if (p->node->father->ekonType != EKON_TYPE_OBJECT) {
+        p->node->key = 0;
+        p->option = 0;
+        p->state = EKON_PARSER_VALUE;
+        break;
+      }
+
+      if (isLast == false && (ekonIsQuote(s[p->index])
+                                  ? ekonParserHasStr(p, p->index)
+                                  : ekonParserHasWord(p, p->index)) == false)
+        return true;
+
+      EkonOption option = 0;
+      index = p->index;
+      if (ekonNodeAddKey(v->a, p->node, s, len, &index, &option, false,
+                         errMessage) == false)
+        return ekonParserFail(p, errMessage);
+      p->option = option;
+      p->index = index;
+      p->state = EKON_PARSER_COLON;
       break;
     }
-
-    EkonOption option = 0;
-    if (c == '"')
-      option |= EKON_IS_STR_ESCAPABLE;
-
-    if (EKON_LIKELY(ekonConsumeStr(s, &index, c, &option))) {
-      u32 strEnd = index - 1;
-      if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-        isRootNoCurlyBrace = true;
-        index = ifRootStart;
-        break;
+    case EKON_PARSER_COLON: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      index = p->index;
+      if (ekonLikelyPeekAndConsume(':', s, len, &index, NULL) == false) {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
       }
-      ekonNodeAddStr(node, s + start, strEnd - start,
-                     (EKON_NODE_OPTIONS)option);
+      p->index = index;
+      p->state = EKON_PARSER_VALUE;
       break;
     }
-    return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-  }
-  default: {
-    index--;
-    u32 start = index;
-    if (c == '-' || c == '+' || (c >= '0' && c <= '9')) {
-      EkonOption option = 0;
-      if (ekonConsumeNum(s, &index, &option)) {
-        u32 numEnd = index;
-        if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-          isRootNoCurlyBrace = true;
-          index = ifRootStart;
-          break;
+    case EKON_PARSER_OPEN: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      EkonNode *currNode = p->node;
+      const EkonNodeOpt opt =
+          (const EkonNodeOpt)(p->open == '{' ? EKON_OPT_IS_OBJ : 0);
+      index = p->index;
+      if (ekonParseContainer(&p->node, v, p->srcNode, s, len, &index, NULL,
+                             errMessage, opt) == false)
+        return ekonParserFail(p, errMessage);
+      p->index = index;
+      if (currNode != p->node)
+        p->state = EKON_PARSER_KEY;
+      else
+        p->state = p->node == v->n ? EKON_PARSER_END : EKON_PARSER_NEXT;
+      break;
+    }
+    case EKON_PARSER_NEXT:
+    case EKON_PARSER_COMMA: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      index = p->index;
+      c = ekonPeek(s, len, &index, NULL);
+      if (c == ',') {
+        if (p->state == EKON_PARSER_COMMA) {
+          ekonParseErrorLen(errMessage, s, len, index);
+          return ekonParserFail(p, errMessage);
         }
-        ekonNodeAddNumber(node, s + start, numEnd - start, option);
+        p->index = index;
+        p->state = EKON_PARSER_COMMA;
         break;
-      } else {
-        index = start;
-        if (ekonConsumeUnquotedStr(s, &index)) {
-          u32 numEnd = index;
-          if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-            isRootNoCurlyBrace = true;
-            index = ifRootStart;
-            break;
-          }
-          ekonNodeAddStr(node, s + start, numEnd - start - 1, 0);
-          index--;
-          break;
+      }
+
+      if (c == 0) {
+        if (p->isRootNoCurlyBrace) {
+          p->node->next = 0;
+          p->state = EKON_PARSER_DONE;
+          return true;
         }
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
+      }
+
+      if (c == ':') {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
       }
-    }
 
-    if (ekonConsumeUnquotedStr(s, &index)) {
-      u32 strEnd = index;
-      if (ekonUnlikelyPeekAndConsume(':', s, &index)) {
-        isRootNoCurlyBrace = true;
-        index = ifRootStart;
+      if (c == '}' || c == ']') {
+        const EkonType type =
+            c == '}' ? EKON_TYPE_OBJECT : EKON_TYPE_ARRAY;
+        if (p->node->father->ekonType == type) {
+          p->node->next = 0;
+          p->node = p->node->father;
+        }
+        p->index = index;
+        p->state = p->node == v->n ? EKON_PARSER_END : EKON_PARSER_NEXT;
+        break;
+      }
+
+      EkonNode *n = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
+      if (EKON_UNLIKELY(n == 0)) {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
+      }
+      n->father = p->node->father;
+      n->prev = p->node;
+      p->node->father->end = n;
+      ++(p->node->father->len);
+      p->node->next = n;
+      p->node = n;
+      p->index = index - 1;
+      p->state = EKON_PARSER_KEY;
+      break;
+    }
+    case EKON_PARSER_ROOT_COLON: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      index = p->index;
+      if (ekonUnlikelyPeekAndConsume(':', s, len, &index, NULL) == false) {
+        p->index = index;
+        p->state = EKON_PARSER_END;
         break;
       }
-      ekonNodeAddStr(node, s + start, strEnd - start, 0);
+      // the root scalar was the first key of an object without curly braces
+      p->isRootNoCurlyBrace = true;
+      index = p->rootStart;
+      if (ekonNodeAddObjOrArrNode(
+              &p->node, v, p->srcNode, s, len, &index, NULL, errMessage,
+              (const EkonNodeOpt)(EKON_OPT_IS_OBJ | EKON_OPT_IS_ROOT_OBJ)) ==
+          false)
+        return ekonParserFail(p, errMessage);
+      p->index = index;
+      p->state = EKON_PARSER_KEY;
       break;
     }
+    case EKON_PARSER_END: {
+      if (ekonParserSkip(p, isLast) == false)
+        return true;
+      index = p->index;
+      if (EKON_UNLIKELY(
+              ekonLikelyPeekAndConsume(0, s, len, &index, NULL) == false)) {
+        ekonParseErrorLen(errMessage, s, len, index);
+        return ekonParserFail(p, errMessage);
+      }
+      p->state = EKON_PARSER_DONE;
+      return true;
+    }
+    case EKON_PARSER_DONE:
+      return true;
+    default:
+      return false;
+    }
+    p->scan = 0;
+  }
+}
 
-    return ekonSrcNodeError(srcNode, v, s, errMessage, index);
+bool ekonParserFeed(EkonParser *p, const char *chunk, u32 len,
+                    char **errMessage, char **schema) {
+  if (EKON_UNLIKELY(p->state == EKON_PARSER_FAILED))
+    return false;
+  if (p->state == EKON_PARSER_DONE || len == 0)
+    return true;
+
+  if (EKON_UNLIKELY(ekonParserAppend(p, chunk, len) == false)) {
+    ekonParseErrorLen(errMessage, p->buf, p->len, p->index);
+    return ekonParserFail(p, errMessage);
   }
+  p->total += len;
+  return ekonParserRun(p, false, errMessage, schema);
+}
+
+bool ekonParserFinish(EkonParser *p, char **errMessage, char **schema) {
+  if (EKON_UNLIKELY(p->state == EKON_PARSER_FAILED))
+    return false;
+  if (EKON_UNLIKELY(p->total == 0)) {
+    ekonParseErrorLen(errMessage, "", 0, 0);
+    return ekonParserFail(p, errMessage);
   }
+  return ekonParserRun(p, true, errMessage, schema);
+}
 
-  if (isRootNoCurlyBrace == true) {
-    if (ekonNodeAddObjOrArrNode(
-            &node, v, srcNode, s, &index, errMessage,
-            (const EkonNodeOpt)(EKON_OPT_IS_OBJ | EKON_OPT_IS_ROOT_OBJ)) == 0) {
-      return false;
-    }
+// -------------- event (SAX) parser ----------------
+
+#ifndef EKON_SAX_MAX_DEPTH
+// deepest nesting of arrays/objects ekonSaxParseLen accepts
+#define EKON_SAX_MAX_DEPTH 1024
+#endif
+
+/**
+ * @brief hand a scalar that was parsed into a node on the stack to the handler
+ * @param h         event handler
+ * @param node      string, number, bool or null node
+ * @return          what the callback returned, true without one
+ * */
+bool ekonSaxScalar(const EkonSaxHandler *h, const EkonNode *node) {
+  switch (node->ekonType) {
+  case EKON_TYPE_STRING:
+    return h->string == NULL ||
+           h->string(h->ctx, node->value.str, node->len, node->option);
+  case EKON_TYPE_NUMBER:
+    return h->number == NULL ||
+           h->number(h->ctx, node->value.str, node->len, node->option);
+  case EKON_TYPE_BOOL:
+    return h->boolean == NULL ||
+           h->boolean(h->ctx, node->value.str == ekonStrTrue);
+  default:
+    return h->null == NULL || h->null(h->ctx);
   }
+}
 
-  while (EKON_LIKELY(node != v->n)) {
+// start an array/object event
+bool ekonSaxStart(const EkonSaxHandler *h, const bool isObj) {
+  if (isObj)
+    return h->startObject == NULL || h->startObject(h->ctx);
+  return h->startArray == NULL || h->startArray(h->ctx);
+}
+
+// end an array/object event
+bool ekonSaxEnd(const EkonSaxHandler *h, const bool isObj) {
+  if (isObj)
+    return h->endObject == NULL || h->endObject(h->ctx);
+  return h->endArray == NULL || h->endArray(h->ctx);
+}
+
+bool ekonSaxParseLen(const char *s, u32 len, const EkonSaxHandler *h,
+                     char **errMessage, char **schema) {
+  if (EKON_UNLIKELY(len == 0))
+    return ekonParseErrorLen(errMessage, s, len, 0);
+
+  EkonStructurals structurals, *st = NULL;
+  if (len >= EKON_STRUCTURAL_MIN_LEN) {
+    ekonStructuralsInit(&structurals, s, len);
+    st = &structurals;
+  }
+
+  // one bit per open array/object, set for objects
+  u64 isObjStack[EKON_SAX_MAX_DEPTH / 64];
+  u32 depth = 0;
+#define EKON_SAX_IS_OBJ()                                                      \
+  ((isObjStack[(depth - 1) / 64] >> ((depth - 1) % 64)) & 1)
+
+  // scalars are parsed into a node on the stack, so that the lexer of
+  // ekonValueParseLen can be used as it is
+  EkonNode scalar;
+  scalar.father = 0;
+
+  u32 index = 0;
+  bool isRootNoCurlyBrace = false;
+  char c = ekonPeek(s, len, &index, st);
+
+  if (c == '`') {
+    const u32 start = index;
+    if (ekonConsumeSchema(s, len, &index) == false)
+      return ekonParseErrorLen(errMessage, s, len, index);
+
+    if (*schema == NULL)
+      *schema = ekonCopySchema(s + start, index - start - 1);
+
+    if (st != NULL)
+      ekonStructuralsInit(st, s, len);
+
+    c = ekonPeek(s, len, &index, st);
+  }
+
+  const u32 ifRootStart = index - 1;
+  bool isRoot = true;
+
+  do {
     EkonOption option = 0;
-    if (node->father->ekonType == EKON_TYPE_OBJECT) {
-      if (ekonNodeAddKey(v->a, node, s, &index, &option, errMessage) == 0)
-        return false;
+    const bool atRoot = isRoot;
+    isRoot = false;
+
+    if (EKON_LIKELY(atRoot == false)) {
+      if (EKON_SAX_IS_OBJ()) {
+        const bool isKeyQuoted = ekonIsQuote(ekonCharAt(s, len, index));
+        u32 start, keyLen;
+        if (ekonConsumeKey(s, len, &index, &start, &keyLen, NULL, &option,
+                           errMessage) == false)
+          return false;
+        if (h->key != NULL &&
+            h->key(h->ctx, s + start, keyLen,
+                   isKeyQuoted ? ekonValueOptionStrToKey(option) : option) ==
+                false)
+          return false;
 
-      if (EKON_UNLIKELY(ekonLikelyPeekAndConsume(':', s, &index) == false))
-        return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-    } else {
-      node->key = 0;
+        if (EKON_UNLIKELY(ekonLikelyPeekAndConsume(':', s, len, &index, st) ==
+                          false))
+          return ekonParseErrorLen(errMessage, s, len, index);
+      }
+      c = ekonPeek(s, len, &index, st);
     }
 
-    c = ekonPeek(s, &index);
-    switch (c) {
-    case '[': {
-      EkonNode *currNode = node;
-      if (!ekonNodeAddObjOrArrNode(&node, v, srcNode, s, &index, errMessage,
-                                   (const EkonNodeOpt)0)) {
+    bool ok;
+    switch ((EkonToken)(ekonClass(c) & EKON_CHAR_TOKEN)) {
+    case EKON_TOKEN_ARRAY:
+    case EKON_TOKEN_OBJECT: {
+      const bool isObj = c == '{';
+      if (EKON_UNLIKELY(depth == EKON_SAX_MAX_DEPTH))
+        return ekonParseErrorLen(errMessage, s, len, index);
+      if (ekonSaxStart(h, isObj) == false)
         return false;
+      if (ekonUnlikelyPeekAndConsume(isObj ? '}' : ']', s, len, &index, st)) {
+        if (ekonSaxEnd(h, isObj) == false)
+          return false;
+        goto parsedValue;
       }
 
-      if (currNode == node)
-        break;
-
-      if (ekonPeek(s, &index) == ',')
-        return ekonParseError(errMessage, s, index);
+      const u64 bit = 1ULL << (depth % 64);
+      isObjStack[depth / 64] =
+          isObj ? isObjStack[depth / 64] | bit : isObjStack[depth / 64] & ~bit;
+      depth++;
 
+      const char nextChar = ekonPeek(s, len, &index, st);
+      if (nextChar == ',' || (nextChar == ':' && isObj))
+        return ekonParseErrorLen(errMessage, s, len, index);
       index--;
       continue;
     }
-    case '{': {
-      EkonNode *currNode = node;
-      if (ekonNodeAddObjOrArrNode(&node, v, srcNode, s, &index, errMessage,
-                                  EKON_OPT_IS_OBJ) == false) {
+    case EKON_TOKEN_KEYWORD:
+      ok = ekonParseKeyword(&scalar, s, len, &index, c, option);
+      break;
+    case EKON_TOKEN_STRING:
+      ok = ekonParseString(&scalar, s, len, &index, c, &option);
+      break;
+    case EKON_TOKEN_NUMBER:
+      ok = ekonParseNumber(&scalar, s, len, &index);
+      break;
+    default:
+      if (c == ',')
+        return ekonParseErrorLen(errMessage, s, len, index);
+      index--;
+      ok = ekonParseUnquoted(&scalar, s, len, &index);
+    }
+    if (EKON_UNLIKELY(ok == false))
+      return ekonParseErrorLen(errMessage, s, len, index);
+
+    // a root scalar followed by ':' is the first key of an object without
+    // curly braces. it is read again as a key
+    if (EKON_UNLIKELY(atRoot) &&
+        ekonUnlikelyPeekAndConsume(':', s, len, &index, st)) {
+      isRootNoCurlyBrace = true;
+      index = ifRootStart;
+      if (ekonSaxStart(h, true) == false)
         return false;
+      isObjStack[0] = 1;
+      depth = 1;
+      continue;
+    }
+    if (ekonSaxScalar(h, &scalar) == false)
+      return false;
+
+  parsedValue:
+    while (EKON_LIKELY(depth != 0)) {
+      char c = ekonPeek(s, len, &index, st);
+      if (c == ',')
+        c = ekonPeek(s, len, &index, st);
+
+      if (c == ',' || c == ':')
+        return ekonParseErrorLen(errMessage, s, len, index);
+
+      if (c == 0) {
+        if (isRootNoCurlyBrace == false)
+          return ekonParseErrorLen(errMessage, s, len, index);
+        // like ekonValueParseLen, the end of the source closes whatever is
+        // still open below the root object without curly braces
+        for (; depth != 0; depth--)
+          if (ekonSaxEnd(h, EKON_SAX_IS_OBJ() != 0) == false)
+            return false;
+        return true;
       }
 
-      if (currNode == node)
+      if (c == '}' || c == ']') {
+        const bool isObj = EKON_SAX_IS_OBJ() != 0;
+        if (isObj == (c == '}')) {
+          depth--;
+          if (ekonSaxEnd(h, isObj) == false)
+            return false;
+        }
+      } else {
+        index--;
         break;
+      }
+    }
+  } while (EKON_LIKELY(depth != 0));
+#undef EKON_SAX_IS_OBJ
 
-      char nextChar = ekonPeek(s, &index);
-      if (nextChar == ':' || nextChar == ',')
-        return ekonParseError(errMessage, s, index);
+  if (EKON_LIKELY(ekonLikelyPeekAndConsume(0, s, len, &index, st)))
+    return true;
+  return ekonParseErrorLen(errMessage, s, len, index);
+}
 
-      index--;
-      continue;
-    }
-    case 'n': {
-      u32 start = index - 1;
-      if (EKON_LIKELY(ekonConsumeNull(s, &index)) == true) {
-        if (ekonIsNonUnquotedStrChar(s[index]) == true) {
-          ekonNodeAddNull(node);
-          break;
-        }
+// -------------- on-demand cursor ----------------
 
-        if (ekonConsumeUnquotedStr(s, &index)) {
-          option &= ~EKON_IS_STR_MULTILINED;
-          option &= ~EKON_IS_STR_SPACED;
-          ekonNodeAddStr(node, s + start, index - start, option);
-          break;
-        }
+/**
+ * @brief lex the scalar whose first char has just been consumed into `node`,
+ *        like ekonValueParseLen does
+ * @param node      node to be filled in
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index right after the first char. updated
+ * @param c         the first char
+ * @return          success/failure
+ * */
+bool ekonCursorScalar(EkonNode *node, const char *s, const u32 len, u32 *index,
+                      const char c) {
+  EkonOption option = 0;
+  switch ((EkonToken)(ekonClass(c) & EKON_CHAR_TOKEN)) {
+  case EKON_TOKEN_KEYWORD:
+    return ekonParseKeyword(node, s, len, index, c, option);
+  case EKON_TOKEN_STRING:
+    return ekonParseString(node, s, len, index, c, &option);
+  case EKON_TOKEN_NUMBER:
+    return ekonParseNumber(node, s, len, index);
+  default:
+    (*index)--;
+    return ekonParseUnquoted(node, s, len, index);
+  }
+}
+
+/**
+ * @brief skip the value that starts at `index` without building it. scalars
+ *        are lexed like ekonValueParseLen lexes them, arrays and objects are
+ *        only checked for balanced brackets
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index of the first char of the value. updated
+ * @param st        structural index or NULL
+ * @return          success/failure
+ * */
+bool ekonCursorSkipValue(const char *s, const u32 len, u32 *index,
+                         EkonStructurals *st) {
+  EkonNode scalar;
+  scalar.father = 0;
+  u32 depth = 0;
+  do {
+    const u32 from = *index;
+    const char c = ekonPeek(s, len, index, st);
+    if (c == '[' || c == '{') {
+      depth++;
+    } else if (c == ']' || c == '}') {
+      if (EKON_UNLIKELY(depth-- == 0))
+        return false;
+    } else if (c == ',' || c == ':') {
+      // keys are skipped like any other scalar, so these are separators as
+      // long as a bracket is open
+      if (EKON_UNLIKELY(depth == 0))
+        return false;
+    } else {
+      // a '\0' before the end is a stray '/' that ekonPeek stopped at. like
+      // ekonValueParseLen, the rest is read as an unquoted string. a '\0'
+      // byte in the source is an error, as there: it reads as an empty
+      // string, so a walk that does not get past it would never end
+      const u32 start = *index - 1;
+      if (EKON_UNLIKELY(c == 0 && (*index > len ||
+                                   (*index != 0 && s[start] == 0))) ||
+          ekonCursorScalar(&scalar, s, len, index, c) == false ||
+          EKON_UNLIKELY(*index <= from))
+        return false;
+
+      // `1//c` is a number and a comment as a value, but a key is read up to
+      // the next whitespace. keys are only told apart by the ':' after them
+      if (EKON_UNLIKELY(ekonCharAt(s, len, *index) == '/') &&
+          scalar.ekonType == EKON_TYPE_NUMBER) {
+        u32 keyEnd = start;
+        if (ekonConsumeUnquotedStr(s, len, &keyEnd) &&
+            ekonUnlikelyPeekAndConsume(':', s, len, &keyEnd, st))
+          *index = keyEnd;
       }
+    }
+  } while (depth != 0);
+  return true;
+}
+
+// structural index for a walk from `index`, NULL when little is left to walk
+EkonStructurals *ekonCursorIndex(EkonStructurals *st, const char *s,
+                                 const u32 len, const u32 index) {
+  if (len - index < EKON_STRUCTURAL_MIN_LEN)
+    return NULL;
+  ekonStructuralsInit(st, s, len);
+  return st;
+}
+
+bool ekonCursorInit(EkonCursor *cur, const char *s, u32 len, char **errMessage,
+                    char **schema) {
+  u32 index = 0;
+  char c = ekonPeek(s, len, &index, NULL);
+
+  if (c == '`') {
+    const u32 start = index;
+    if (ekonConsumeSchema(s, len, &index) == false)
+      return ekonParseErrorLen(errMessage, s, len, index);
+
+    if (*schema == NULL)
+      *schema = ekonCopySchema(s + start, index - start - 1);
+
+    c = ekonPeek(s, len, &index, NULL);
+  }
+  if (EKON_UNLIKELY(c == 0))
+    return ekonParseErrorLen(errMessage, s, len, index);
+
+  cur->s = s;
+  cur->len = len;
+  cur->index = --index;
+  cur->isRootObj = false;
+  if (c == '{' || c == '[')
+    return true;
+
+  // a root scalar followed by ':' is the first key of an object without
+  // curly braces
+  if (ekonCursorSkipValue(s, len, &index, NULL) == false)
+    return ekonParseErrorLen(errMessage, s, len, index);
+  cur->isRootObj = ekonUnlikelyPeekAndConsume(':', s, len, &index, NULL);
+  return true;
+}
+
+bool ekonCursorFindFieldLen(EkonCursor *cur, const char *key, u32 keyLen) {
+  const char *s = cur->s;
+  const u32 len = cur->len;
+  u32 index = cur->index;
+
+  EkonStructurals structurals;
+  EkonStructurals *st = ekonCursorIndex(&structurals, s, len, index);
+
+  if (cur->isRootObj == false &&
+      ekonLikelyPeekAndConsume('{', s, len, &index, st) == false)
+    return false;
+
+  for (;;) {
+    const char c = ekonPeek(s, len, &index, st);
+    if (c == '}' || c == 0)
+      return false;
+    index--;
+
+    u32 start, n;
+    EkonOption option = 0;
+    if (ekonConsumeKey(s, len, &index, &start, &n, NULL, &option, NULL) ==
+        false)
+      return false;
+    if (EKON_UNLIKELY(ekonLikelyPeekAndConsume(':', s, len, &index, st) ==
+                      false))
+      return false;
+
+    if (ekonStrIsEqualLen(s + start, n, key, keyLen)) {
+      if (ekonStructuralsSkip(s, len, &index, st) == false)
+        return false;
+      cur->index = index;
+      cur->isRootObj = false;
+      return true;
+    }
+
+    if (ekonCursorSkipValue(s, len, &index, st) == false)
+      return false;
+    ekonLikelyPeekAndConsume(',', s, len, &index, st);
+  }
+}
+
+bool ekonCursorFindField(EkonCursor *cur, const char *key) {
+  return ekonCursorFindFieldLen(cur, key, ekonStrLen(key));
+}
+
+bool ekonCursorArrayAt(EkonCursor *cur, u32 i) {
+  const char *s = cur->s;
+  const u32 len = cur->len;
+  u32 index = cur->index;
+
+  EkonStructurals structurals;
+  EkonStructurals *st = ekonCursorIndex(&structurals, s, len, index);
+
+  if (cur->isRootObj ||
+      ekonLikelyPeekAndConsume('[', s, len, &index, st) == false)
+    return false;
+
+  for (u32 n = 0;; n++) {
+    const char c = ekonPeek(s, len, &index, st);
+    if (c == ']' || c == 0)
+      return false;
+    index--;
+
+    if (n == i) {
+      cur->index = index;
+      return true;
+    }
+
+    if (ekonCursorSkipValue(s, len, &index, st) == false)
+      return false;
+    ekonLikelyPeekAndConsume(',', s, len, &index, st);
+  }
+}
+
+bool ekonCursorGet(const EkonCursor *cur, EkonValue *v, char **errMessage) {
+  const char *s = cur->s;
+  const u32 len = cur->len;
+  const char c = ekonCharAt(s, len, cur->index);
+
+  if (cur->isRootObj == false && ekonIsBracket(c) == false) {
+    // a scalar is lexed in place, as the char after it can change how it is
+    // read: `0o17` is only a number at the very end of a source
+    EkonNode *srcNode;
+    if (EKON_UNLIKELY(ekonValueParseBegin(v, &srcNode) == false))
+      return ekonParseErrorLen(errMessage, s, len, cur->index);
+    u32 index = cur->index + 1;
+    if (ekonCursorScalar(v->n, s, len, &index, c))
+      return true;
+    return ekonSrcNodeError(srcNode, v, s, len, errMessage, index);
+  }
+
+  u32 end = len;
+  if (cur->isRootObj == false) {
+    EkonStructurals structurals;
+    EkonStructurals *st = ekonCursorIndex(&structurals, s, len, cur->index);
+    end = cur->index;
+    if (ekonCursorSkipValue(s, len, &end, st) == false)
+      return ekonParseErrorLen(errMessage, s, len, end);
+  }
 
-      index--;
-      if (ekonConsumeUnquotedStr(s, &index)) {
-        option &= ~EKON_IS_STR_MULTILINED;
-        option &= ~EKON_IS_STR_SPACED;
-        ekonNodeAddStr(node, s + start, index - start, option);
-        break;
-      }
+  return ekonValueParseLen(v, s + cur->index, end - cur->index, errMessage,
+                           NULL);
+}
 
-      return ekonSrcNodeError(node, v, s, errMessage, index);
-    }
-    case 'f': {
-      u32 start = index - 1;
-      if (EKON_LIKELY(ekonConsumeFalse(s, &index))) {
-        if (ekonIsNonUnquotedStrChar(s[index]) == true) {
-          ekonNodeAddBoolean(node, false);
-          break;
-        }
+// -------------- multi-document stream ----------------
 
-        if (ekonConsumeUnquotedStr(s, &index)) {
-          option &= ~EKON_IS_STR_MULTILINED;
-          option &= ~EKON_IS_STR_SPACED;
-          ekonNodeAddStr(node, s + start, index - start, option);
-          break;
-        }
-      }
+// documents one after the other in a source - see ekonDocStreamNew
+struct _EkonDocStream {
+  EkonAllocator *a; // rewound for every document
+  const char *s;
+  u32 len;
+  u32 index; // where the next document is looked for
+  EkonStructurals st;
+  bool hasSt;
+};
 
-      index--;
-      if (ekonConsumeUnquotedStr(s, &index)) {
-        option &= ~EKON_IS_STR_MULTILINED;
-        option &= ~EKON_IS_STR_SPACED;
-        ekonNodeAddStr(node, s + start, index - start, option);
-        break;
-      }
+// index of the '\n' that ends the line `index` is on, `len` on the last line
+u32 ekonLineEnd(const char *s, const u32 len, const u32 index) {
+  const char *nl = (const char *)memchr(s + index, '\n', len - index);
+  return nl != NULL ? (u32)(nl - s) : len;
+}
 
-      return ekonSrcNodeError(node, v, s, errMessage, index);
+/**
+ * @brief find the end of the document whose first token is at `index`. one
+ *        in brackets ends at its closing bracket. any other one ends with the
+ *        line it is on, or the line its last value ends on when brackets or
+ *        strings go on over several lines. a broken document only takes the
+ *        line it starts on with it, so that the ones after it can be read
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index of the first token of the document
+ * @param st        structural index or NULL
+ * @return          index right after the document
+ * */
+u32 ekonDocStreamEnd(const char *s, const u32 len, u32 index,
+                     EkonStructurals *st) {
+  const u32 start = index;
+  if (ekonCharAt(s, len, index) == '`') {
+    index++;
+    if (ekonConsumeSchema(s, len, &index) == false)
+      return ekonLineEnd(s, len, start);
+    // the schema is not EKON. index the rest of the source from scratch
+    if (st != NULL)
+      ekonStructuralsInit(st, s, len);
+    if (ekonStructuralsSkip(s, len, &index, st) == false)
+      return ekonLineEnd(s, len, start);
+  }
+
+  if (ekonIsBracket(ekonCharAt(s, len, index))) {
+    if (EKON_LIKELY(ekonCursorSkipValue(s, len, &index, st)))
+      return index;
+    return ekonLineEnd(s, len, start);
+  }
+
+  EkonNode scalar;
+  scalar.father = 0;
+  for (;;) {
+    const u32 tokenEnd = index;
+    char c = ekonCharAt(s, len, index);
+    while (c == ' ' || c == '\t' || c == '\r')
+      c = ekonCharAt(s, len, ++index);
+
+    if (c == '\n' || index >= len)
+      return tokenEnd;
+
+    // a comment runs to the end of the line, which ends the document too
+    if (c == '/' && ekonCharAt(s, len, index + 1) == '/')
+      return ekonLineEnd(s, len, index);
+
+    if (c == '[' || c == '{') {
+      if (ekonCursorSkipValue(s, len, &index, st) == false)
+        return ekonLineEnd(s, len, start);
+    } else if (ekonIsQuote(c) == false &&
+               (ekonClass(c) & (EKON_CHAR_END | EKON_CHAR_CONTROL)) != 0) {
+      // ',', ':', a stray closing bracket, ... left for the parser to report
+      index++;
+    } else {
+      index++;
+      if (ekonCursorScalar(&scalar, s, len, &index, c) == false)
+        return ekonLineEnd(s, len, start);
     }
-    case 't': {
-      u32 start = index - 1;
-      if (EKON_LIKELY(ekonConsumeTrue(s, &index))) {
-        if (ekonIsNonUnquotedStrChar(s[index]) == true) {
-          ekonNodeAddBoolean(node, true);
-          break;
-        }
+  }
+}
 
-        if (ekonConsumeUnquotedStr(s, &index)) {
-          option &= ~EKON_IS_STR_MULTILINED;
-          option &= ~EKON_IS_STR_SPACED;
-          ekonNodeAddStr(node, s + start, index - start, option);
-          break;
-        }
-      }
+EkonDocStream *ekonDocStreamNew(const char *s, u32 len) {
+  EkonDocStream *ds = (EkonDocStream *)ekonNew(sizeof(EkonDocStream));
+  if (EKON_UNLIKELY(ds == 0))
+    return 0;
+  ds->a = ekonAllocatorNew();
+  if (EKON_UNLIKELY(ds->a == 0)) {
+    ekonFree((void *)ds);
+    return 0;
+  }
+  ds->s = s;
+  ds->len = len;
+  ds->index = 0;
+  ds->hasSt = len >= EKON_STRUCTURAL_MIN_LEN;
+  if (ds->hasSt)
+    ekonStructuralsInit(&ds->st, s, len);
+  return ds;
+}
+
+bool ekonDocStreamNext(EkonDocStream *ds, EkonValue **outV, u32 *outStart,
+                       u32 *outLen, char **errMessage, char **schema) {
+  const char *s = ds->s;
+  const u32 len = ds->len;
+  EkonStructurals *st = ds->hasSt ? &ds->st : NULL;
+
+  // documents are mostly a newline apart, the index is no help there
+  u32 index = ds->index;
+  ekonConsumeWhiteChars(s, len, &index);
+  if (index >= len) {
+    ds->index = len;
+    return false;
+  }
 
-      index--;
-      if (ekonConsumeUnquotedStr(s, &index)) {
-        option &= ~EKON_IS_STR_MULTILINED;
-        option &= ~EKON_IS_STR_SPACED;
-        ekonNodeAddStr(node, s + start, index - start, option);
-        break;
-      }
-      return ekonSrcNodeError(node, v, s, errMessage, index);
+  // most streams hold a document in brackets per line, so the line is tried
+  // first. only when it does not parse on its own are the boundaries looked
+  // for. other documents are not tried this way, as a root object without
+  // curly braces is closed by the end of the source it is parsed from
+  u32 end = ekonLineEnd(s, len, index);
+  while (end > index && ekonSkin(s[end - 1]))
+    end--;
+  int pass = 0;
+  if (ekonIsBracket(s[index]) == false) {
+    end = ekonDocStreamEnd(s, len, index, st);
+    pass = 1;
+  }
+  for (; pass < 2; pass++) {
+    ekonAllocatorReset(ds->a, EKON_RESET_KEEP_LARGEST);
+    *outV = ekonValueNew(ds->a);
+    if (EKON_UNLIKELY(*outV == 0)) {
+      ekonParseErrorLen(errMessage, s, len, index);
+      break;
     }
-    case '\'':
-    case '"': {
-      u32 start = index;
-      if (c == '"')
-        option |= EKON_IS_STR_ESCAPABLE;
-
-      if (EKON_UNLIKELY(ekonUnlikelyConsume(c, s, &index))) {
-        option |= EKON_IS_STR_SPACED;
-        option &= ~EKON_IS_STR_MULTILINED;
-        ekonNodeAddStr(node, s + index, 0, option);
-        break;
-      }
 
-      if (EKON_LIKELY(ekonConsumeStr(s, &index, c, &option))) {
-        ekonNodeAddStr(node, s + start, index - start - 1, option);
-        break;
-      }
-      return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-    }
-    default: {
-      if (c == ',')
-        return ekonParseError(errMessage, s, index);
+    // no message for a line that is parsed again
+    if (ekonValueParseLen(*outV, s + index, end - index,
+                          pass == 0 ? NULL : errMessage, schema))
+      break;
+    *outV = 0;
+    if (pass == 0)
+      end = ekonDocStreamEnd(s, len, index, st);
+  }
 
-      index--;
-      u32 start = index;
-      EkonOption option = 0;
-      if (c == '-' || c == '+' || (c >= '0' && c <= '9')) {
-        if (ekonConsumeNum(s, &index, &option)) {
-          ekonNodeAddNumber(node, s + start, index - start, option);
-          break;
-        } else {
-          index = start;
-          if (ekonConsumeUnquotedStr(s, &index)) {
-            u32 numEnd = index;
-            option &= ~EKON_IS_STR_SPACED;
-            option &= ~EKON_IS_STR_MULTILINED;
-            ekonNodeAddStr(node, s + start, numEnd - start, option);
-            break;
-          }
-        }
-      }
+  *outStart = index;
+  *outLen = end - index;
+  ds->index = end;
+  return true;
+}
 
-      if (ekonConsumeUnquotedStr(s, &index)) {
-        u32 strEnd = index;
-        option &= ~EKON_IS_STR_SPACED;
-        option &= ~EKON_IS_STR_MULTILINED;
-        ekonNodeAddStr(node, s + start, strEnd - start, option);
-        break;
-      }
+void ekonDocStreamSetKeyTable(EkonDocStream *ds, EkonKeyTable *t) {
+  ds->a->keys = t;
+}
 
-      return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-    }
-    }
+void ekonDocStreamRelease(EkonDocStream *ds) {
+  ekonAllocatorRelease(ds->a);
+  ekonFree((void *)ds);
+}
 
-    while (EKON_LIKELY(node != v->n)) {
-      char c = ekonPeek(s, &index);
-      if (c == ',')
-        c = ekonPeek(s, &index);
+// -------------- parallel parse ----------------
 
-      if (c == ',') {
-        ekonParseError(errMessage, s, index);
-        return false;
-      }
+// smallest run of top-level values that gets a thread of its own
+#ifndef EKON_PARALLEL_MIN_SLICE
+#define EKON_PARALLEL_MIN_SLICE (1 << 16)
+#endif
+#define EKON_PARALLEL_MAX_THREADS 64
 
-      if (c == 0) {
-        if (isRootNoCurlyBrace) {
-          node->next = 0;
-          return true;
-        } else {
-          ekonParseError(errMessage, s, index);
+// a run of values of the root array/object, parsed by one thread
+typedef struct {
+  const char *s; // first value of the run. it goes on up to the next run
+  u32 len;
+  char open;      // bracket of the root
+  char close;     // closing bracket, 0 for the last run that has the root's
+  EkonNode *root; // root node of the whole source
+  EkonAllocator a;
+  EkonKeyTable *keys; // key table of the parse if it is frozen, or NULL
+  EkonNode *n; // the run parsed on its own, NULL if it does not parse
+} EkonParallelSlice;
+
+/**
+ * @brief parse a run of values. a copy of it inside the brackets of the root
+ *        is parsed into the allocator of the run, then the values are moved
+ *        under the root of the whole source
+ * @param arg   the EkonParallelSlice
+ * @return      NULL
+ * */
+void *ekonParallelParse(void *arg) {
+  EkonParallelSlice *sl = (EkonParallelSlice *)arg;
+  const u32 len = sl->len + (sl->close != 0 ? 2 : 1);
+  sl->n = 0;
+  if (EKON_UNLIKELY(ekonAllocatorInit(&sl->a, len + EKON_PADDING +
+                                                  ekonAllocatorInitMemSize) ==
+                    false))
+    return NULL;
+  sl->a.keys = sl->keys;
+
+  // the values point into the copy, so it stays with them in the allocator.
+  // its size is rounded up to keep the nodes after it aligned
+  char *buf = ekonAllocatorAlloc(&sl->a, (len + EKON_PADDING + 7) & ~7U);
+  buf[0] = sl->open;
+  memcpy(buf + 1, sl->s, sl->len);
+  if (sl->close != 0)
+    buf[len - 1] = sl->close;
+  memset(buf + len, 0, EKON_PADDING);
+
+  EkonValue v;
+  v.a = &sl->a;
+  v.n = 0;
+  // a run that does not parse is left to the parse of the whole source,
+  // which reports the error
+  if (EKON_LIKELY(ekonValueParseLen(&v, buf, len, NULL, NULL))) {
+    EkonNode *n;
+    for (n = v.n->value.node; n != 0; n = n->next)
+      n->father = sl->root;
+    sl->n = v.n;
+  }
+  return NULL;
+}
+
+// where the values of the root are split into runs
+typedef struct {
+  EkonParallelSlice *slices;
+  u32 n;       // runs so far
+  u32 threads; // runs wanted
+  u32 next;    // a value that starts at or after it starts a new run
+} EkonParallelSplit;
+
+// a value of the root starts at `start`. true once the last run has started,
+// it goes on to the end of the source
+bool ekonParallelValue(EkonParallelSplit *sp, const char *s, const u32 len,
+                       const u32 start) {
+  if (start < sp->next)
+    return false;
+  if (sp->n != 0)
+    sp->slices[sp->n - 1].len = start - (u32)(sp->slices[sp->n - 1].s - s);
+  sp->slices[sp->n++].s = s + start;
+  sp->next = (u32)((u64)len * sp->n / sp->threads);
+  return sp->n == sp->threads;
+}
+
+/**
+ * @brief split the values of the root with the structural index alone: its
+ *        bits are walked one after the other and the values are told apart
+ *        by the brackets around them. this is a lot faster than lexing them,
+ *        but it gives up on what the index may read differently from the
+ *        parser: '/' outside of `//` comments, `//` glued to a scalar,
+ *        mismatched brackets and deep nesting
+ * @param sp        the split. `slices` and `threads` are set
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index right after the opening bracket of the root
+ * @param st        structural index
+ * @param isObj     the root is an object
+ * @return          false if it gave up
+ * */
+bool ekonParallelSplitFast(EkonParallelSplit *sp, const char *s, const u32 len,
+                           const u32 index, EkonStructurals *st,
+                           const bool isObj) {
+  u64 isObjStack = isObj;
+  u32 depth = 1;
+  bool isKey = isObj;
+  sp->n = sp->next = 0;
+  st->state = 0;
+  st->escaped = false;
+  st->prevScalar = 0;
+  ekonStructuralsBuild(st, index);
+  for (;;) {
+    const u32 blocks = (st->end - st->start + 63) >> 6;
+    for (u32 b = 0; b < blocks; b++) {
+      u64 bits = st->bits[b];
+      while (bits != 0) {
+        const u32 at = st->start + (b << 6) + ekonCtz64(bits);
+        const char c = s[at];
+        bits &= bits - 1;
+        if (c == '[' || c == '{') {
+          if (EKON_UNLIKELY(depth == 64 || (depth == 1 && isKey)))
+            return false;
+          if (depth == 1 && ekonParallelValue(sp, s, len, at))
+            return st->glued == false;
+          isObjStack = (isObjStack << 1) | (c == '{');
+          depth++;
+        } else if (c == ']' || c == '}') {
+          if (EKON_UNLIKELY((isObjStack & 1) != (c == '}')))
+            return false;
+          isObjStack >>= 1;
+          if (--depth == 0)
+            return st->glued == false;
+          isKey = isObj;
+        } else if (EKON_UNLIKELY(c == '/')) {
           return false;
+        } else if (c != ',' && c != ':' && depth == 1) {
+          // a scalar or a string, its other bytes are not in the index
+          if ((isObj == false || isKey) && ekonParallelValue(sp, s, len, at))
+            return st->glued == false;
+          isKey = isObj && isKey == false;
         }
       }
+    }
+    if (st->end >= len)
+      return false;
+    ekonStructuralsBuild(st, st->end);
+  }
+}
 
-      if (c == ':') {
-        ekonParseError(errMessage, s, index);
-        return false;
-      }
+/**
+ * @brief split the values of the root, lexing them like ekonCursorSkipValue
+ *        does. for the sources ekonParallelSplitFast gives up on
+ * @param sp        the split. `slices` and `threads` are set
+ * @param s         EKON string
+ * @param len       length of the source
+ * @param index     index right after the opening bracket of the root
+ * @param st        structural index
+ * @param isObj     the root is an object
+ * @return          false if the root does not parse
+ * */
+bool ekonParallelSplitExact(EkonParallelSplit *sp, const char *s,
+                            const u32 len, u32 index, EkonStructurals *st,
+                            const bool isObj) {
+  const char close = isObj ? '}' : ']';
+  sp->n = sp->next = 0;
+  for (;;) {
+    const u32 from = index;
+    const char c = ekonPeek(s, len, &index, st);
+    // a '\0' is the end of the source or a stray '/'
+    if (EKON_UNLIKELY(c == 0))
+      return false;
+    if (c == close || ekonParallelValue(sp, s, len, --index))
+      return true;
+    if (isObj && (ekonCursorSkipValue(s, len, &index, st) == false ||
+                  ekonLikelyPeekAndConsume(':', s, len, &index, st) == false))
+      return false;
+    // a split that does not get on is left to the serial parse, which
+    // reports the error
+    if (ekonCursorSkipValue(s, len, &index, st) == false ||
+        EKON_UNLIKELY(index <= from))
+      return false;
+    if (ekonPeek(s, len, &index, st) != ',')
+      index--;
+  }
+}
 
-      if (c == '}' || c == ']') {
-        if (c == '}') {
-          if (node->father->ekonType == EKON_TYPE_OBJECT) {
-            node->next = 0;
-            node = node->father;
-          }
-        } else {
-          if (node->father->ekonType == EKON_TYPE_ARRAY) {
-            node->next = 0;
-            node = node->father;
-          }
-        }
-      } else {
-        EkonNode *n = (EkonNode *)ekonAllocatorAlloc(v->a, sizeof(EkonNode));
+// add the keys from `n` to the last value of its run to the keymap of the
+// root. false for a key an earlier run has too
+bool ekonParallelMergeKeys(EkonAllocator *a, EkonHashmap *keymap,
+                           EkonNode *n) {
+  for (; n != 0; n = n->next) {
+    if (EKON_UNLIKELY(ekonHashmapGet(keymap, n->key, n->keyLen, n->keyHash) !=
+                      NULL))
+      return false;
+    if (EKON_UNLIKELY(ekonHashmapPut(a, keymap, n->key, n->keyLen, n->keyHash,
+                                     n, &n->hashItem) == false))
+      return false;
+  }
+  return true;
+}
 
-        if (EKON_UNLIKELY(n == 0))
-          return ekonSrcNodeError(srcNode, v, s, errMessage, index);
+bool ekonValueParseParallel(EkonValue *v, const char *s, u32 len, u32 threads,
+                            char **errMessage, char **schema) {
+#if defined(EKON_THREADS)
+  if (threads == 0) {
+    const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = cores > 0 ? (u32)cores : 1;
+  }
+#endif
+  if (threads > len / EKON_PARALLEL_MIN_SLICE)
+    threads = len / EKON_PARALLEL_MIN_SLICE;
+  if (threads > EKON_PARALLEL_MAX_THREADS)
+    threads = EKON_PARALLEL_MAX_THREADS;
+  if (threads < 2)
+    return ekonValueParseLen(v, s, len, errMessage, schema);
+
+  EkonStructurals structurals, *st = &structurals;
+  ekonStructuralsInit(st, s, len);
+  u32 index = 0, schemaStart = 0, schemaEnd = 0;
+  char open = ekonPeek(s, len, &index, st);
+  if (open == '`') {
+    schemaStart = index;
+    if (ekonConsumeSchema(s, len, &index) == false)
+      return ekonValueParseLen(v, s, len, errMessage, schema);
+    schemaEnd = index - 1;
+    // the schema is not EKON. index the rest of the source from scratch
+    ekonStructuralsInit(st, s, len);
+    open = ekonPeek(s, len, &index, st);
+  }
+  // a root object without curly braces is left to ekonValueParseLen too
+  if (open != '[' && open != '{')
+    return ekonValueParseLen(v, s, len, errMessage, schema);
+
+  // split the values of the root into runs of about the same length. only
+  // where they start is looked for here, without building anything. the
+  // last run goes on to the end of the source, the parser checks the rest
+  EkonParallelSlice slices[EKON_PARALLEL_MAX_THREADS];
+  EkonParallelSplit sp;
+  const bool isObj = open == '{';
+  sp.slices = slices;
+  sp.threads = threads;
+  if (ekonParallelSplitFast(&sp, s, len, index, st, isObj) == false) {
+    ekonStructuralsInit(st, s, len);
+    if (ekonParallelSplitExact(&sp, s, len, index, st, isObj) == false)
+      return ekonValueParseLen(v, s, len, errMessage, schema);
+  }
+  const u32 n = sp.n;
+  if (n < 2)
+    return ekonValueParseLen(v, s, len, errMessage, schema);
+  slices[n - 1].len = len - (u32)(slices[n - 1].s - s);
 
-        n->father = node->father;
-        n->prev = node;
+  EkonNode *srcNode;
+  if (EKON_UNLIKELY(ekonValueParseBegin(v, &srcNode) == false))
+    return ekonParseErrorLen(errMessage, s, len, 0);
 
-        node->father->end = n;
-        ++(node->father->len);
-        node->next = n;
-        node = n;
-        index--;
-        break;
+  u32 i;
+  for (i = 0; i < n; i++) {
+    slices[i].open = open;
+    slices[i].close = i + 1 < n ? (isObj ? '}' : ']') : 0;
+    slices[i].root = v->n;
+    slices[i].a.root = 0;
+    // a table that still learns keys is not to be written to by threads
+    slices[i].keys =
+        v->a->keys != 0 && v->a->keys->isFrozen ? v->a->keys : 0;
+  }
+#if defined(EKON_THREADS)
+  pthread_t workers[EKON_PARALLEL_MAX_THREADS];
+  bool started[EKON_PARALLEL_MAX_THREADS];
+  for (i = 1; i < n; i++)
+    started[i] = pthread_create(&workers[i], NULL, ekonParallelParse,
+                                &slices[i]) == 0;
+  ekonParallelParse(&slices[0]);
+  for (i = 1; i < n; i++) {
+    if (started[i])
+      pthread_join(workers[i], NULL);
+    else
+      ekonParallelParse(&slices[i]);
+  }
+#else
+  for (i = 0; i < n; i++)
+    ekonParallelParse(&slices[i]);
+#endif
+
+  // link the runs together under the root. errors, duplicate keys across
+  // runs too, are left to ekonValueParseLen, which reports them
+  EkonNode *root = v->n;
+  bool ok = true;
+  root->ekonType = isObj ? EKON_TYPE_OBJECT : EKON_TYPE_ARRAY;
+  root->value.node = 0;
+  root->end = 0;
+  root->len = 0;
+  for (i = 0; ok && i < n; i++) {
+    const EkonNode *run = slices[i].n;
+    if (EKON_UNLIKELY(run == 0 || run->len == 0)) {
+      ok = false;
+    } else if (i == 0) {
+      root->value.node = run->value.node;
+      if (isObj)
+        root->keymap = run->keymap;
+    } else {
+      if (isObj && root->keymap == 0) {
+        root->keymap = ekonNodeKeymapNew(v->a, root->end, root->len + run->len);
+        ok = root->keymap != 0;
       }
+      root->end->next = run->value.node;
+      run->value.node->prev = root->end;
+      if (isObj && ok)
+        ok = ekonParallelMergeKeys(v->a, root->keymap, run->value.node);
+    }
+    if (ok) {
+      root->end = run->end;
+      root->len += run->len;
     }
   }
 
-  if (EKON_LIKELY(ekonLikelyPeekAndConsume(0, s, &index)))
-    return true;
-
-  return ekonSrcNodeError(srcNode, v, s, errMessage, index);
-}
-
-// ekon parse - API
-bool ekonValueParseLen(EkonValue *v, const char *s, u32 len, char **err,
-                       char **schema) {
-  char *str = ekonAllocatorAlloc(v->a, len + 1);
-  if (EKON_UNLIKELY(str == 0))
-    return false;
-  ekonCopy(s, len, str);
-  str[len] = 0;
-  return ekonValueParseFast(v, s, err, schema);
-}
+  if (EKON_UNLIKELY(ok == false)) {
+    for (i = 0; i < n; i++)
+      ekonAllocatorDrop(&slices[i].a);
+    if (srcNode == 0)
+      v->n = 0;
+    else
+      *v->n = *srcNode;
+    return ekonValueParseLen(v, s, len, errMessage, schema);
+  }
 
-// The main parser - API
-bool ekonValueParse(EkonValue *v, const char *s, char **err, char **schema) {
-  return ekonValueParseLen(v, s, ekonStrLen(s), err, schema);
+  for (i = 0; i < n; i++)
+    ekonAllocatorJoin(v->a, &slices[i].a);
+  if (schemaEnd != 0 && *schema == NULL)
+    *schema = ekonCopySchema(s + schemaStart, schemaEnd - schemaStart);
+  return true;
 }
 
 // -------------- util functions for stringifying ----------------
@@ -2876,7 +7306,10 @@ bool ekonUtilAppendStr(EkonString *str, EkonNode *node, const EkonValue *v,
   u32 finalLen = node->len;
   const char *ss;
   if ((node->option & EKON_IS_STR_ESCAPABLE) != 0) {
-    ss = ekonEscapeStr(node->value.str, v->a, &finalLen);
+    // parsed strings are not terminated, they end where the node says
+    ss = ekonEscapeStrLen(node->value.str, v->a, node->len, &finalLen);
+    if (EKON_UNLIKELY(ss == 0))
+      return false;
   } else {
     ss = node->value.str;
   }
@@ -3320,11 +7753,10 @@ const bool ekonValueGetDouble(EkonValue *v, f64 *d) {
     return 0;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_NUMBER))
     return 0;
-  d = (f64 *)ekonAllocatorAlloc(v->a, sizeof(f64));
-  if (EKON_UNLIKELY(d == 0))
-    return 0;
-  if (ekonStrToDouble(v->n->value.str, d) == false)
+  if (EKON_UNLIKELY(ekonNodeNum(v->n) == false))
     return false;
+  *d = (v->n->option & EKON_IS_NUM_FLOAT) != 0 ? v->n->num.d
+                                               : (f64)v->n->num.i;
   return true;
 }
 
@@ -3338,11 +7770,10 @@ const bool ekonValueGetInt(EkonValue *v, int *i) {
     return 0;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_NUMBER))
     return 0;
-  i = (int *)ekonAllocatorAlloc(v->a, sizeof(int));
-  if (EKON_UNLIKELY(i == 0))
-    return 0;
-  if (ekonStrToInt(v->n->value.str, i) == false)
+  i64 n;
+  if (ekonNodeNumInt(v->n, INT_MIN, INT_MAX, &n) == false)
     return false;
+  *i = (int)n;
   return true;
 }
 
@@ -3351,11 +7782,10 @@ const bool ekonValueGetLong(EkonValue *v, long *l) {
     return 0;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_NUMBER))
     return 0;
-  l = (long *)ekonAllocatorAlloc(v->a, sizeof(long));
-  if (EKON_UNLIKELY(l == 0))
-    return 0;
-  if (ekonStrToLong(v->n->value.str, l) == false)
+  i64 n;
+  if (ekonNodeNumInt(v->n, LONG_MIN, LONG_MAX, &n) == false)
     return false;
+  *l = (long)n;
   return true;
 }
 
@@ -3364,11 +7794,10 @@ const bool ekonValueGetLongLong(EkonValue *v, long long *ll) {
     return 0;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_NUMBER))
     return 0;
-  ll = (long long *)ekonAllocatorAlloc(v->a, sizeof(long long));
-  if (EKON_UNLIKELY(ll == 0))
-    return 0;
-  if (ekonStrToLongLong(v->n->value.str, ll) == false)
+  i64 n;
+  if (ekonNodeNumInt(v->n, INT64_MIN, INT64_MAX, &n) == false)
     return false;
+  *ll = n;
   return true;
 }
 
@@ -3377,11 +7806,8 @@ const bool ekonValueGetBool(const EkonValue *v, bool *outBool) {
     return 0;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_BOOL))
     return 0;
-  bool *val = (bool *)malloc(1);
-  *val = false;
-  if (*(v->n->value.str) == 't')
-    *val = true;
-  return val;
+  *outBool = *(v->n->value.str) == 't';
+  return true;
 }
 
 bool ekonValueIsNull(const EkonValue *v) {
@@ -3435,12 +7861,18 @@ const char *ekonValueGetKeyFast(const EkonValue *v, u32 *len) {
   return v->n->key;
 }
 
+u32 ekonValueGetKeyId(const EkonValue *v) {
+  if (EKON_UNLIKELY(v->n == 0 || v->n->key == 0))
+    return 0;
+  return v->n->keyId;
+}
+
 EkonValue *ekonValueObjGet(const EkonValue *v, const char *key) {
   if (EKON_UNLIKELY(v->n == 0))
     return NULL;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_OBJECT))
     return NULL;
-  EkonNode *val = ekonHashmapGet(v->n->keymap, key, strlen(key));
+  EkonNode *val = ekonNodeObjFind(v->a, v->n, key, strlen(key));
   if (val == NULL)
     return NULL;
   return ekonValueInnerNew(v->a, val);
@@ -3451,7 +7883,27 @@ EkonValue *ekonValueObjGetLen(const EkonValue *v, const char *key, u32 keyLen) {
     return NULL;
   if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_OBJECT))
     return NULL;
-  EkonNode *val = ekonHashmapGet(v->n->keymap, key, keyLen);
+  EkonNode *val = ekonNodeObjFind(v->a, v->n, key, keyLen);
+  if (val == NULL)
+    return NULL;
+  return ekonValueInnerNew(v->a, val);
+}
+
+EkonKey ekonKeyPrepare(const char *key, u32 keyLen) {
+  EkonKey k;
+  k.key = key;
+  k.len = keyLen;
+  k.hash = ekonHashmapHash(key, keyLen);
+  return k;
+}
+
+EkonValue *ekonValueObjGetPrepared(const EkonValue *v, const EkonKey *key) {
+  if (EKON_UNLIKELY(v->n == 0))
+    return NULL;
+  if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_OBJECT))
+    return NULL;
+  EkonNode *val =
+      ekonNodeObjFindHashed(v->a, v->n, key->key, key->len, key->hash);
   if (val == NULL)
     return NULL;
   return ekonValueInnerNew(v->a, val);
@@ -3490,6 +7942,42 @@ EkonValue *ekonValueArrayGet(const EkonValue *v, u32 index) {
   return 0;
 }
 
+u32 ekonValueArrayGetDoubles(EkonValue *v, f64 *out, u32 cap) {
+  if (EKON_UNLIKELY(v->n == 0))
+    return 0;
+  if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_ARRAY))
+    return 0;
+  u32 count = 0;
+  for (EkonNode *next = v->n->value.node; next != 0 && count < cap;
+       next = next->next) {
+    if (EKON_UNLIKELY(next->ekonType != EKON_TYPE_NUMBER))
+      break;
+    if (EKON_UNLIKELY(ekonNodeNum(next) == false))
+      break;
+    out[count++] = (next->option & EKON_IS_NUM_FLOAT) != 0 ? next->num.d
+                                                          : (f64)next->num.i;
+  }
+  return count;
+}
+
+u32 ekonValueArrayGetInt64s(EkonValue *v, i64 *out, u32 cap) {
+  if (EKON_UNLIKELY(v->n == 0))
+    return 0;
+  if (EKON_UNLIKELY(v->n->ekonType != EKON_TYPE_ARRAY))
+    return 0;
+  u32 count = 0;
+  for (EkonNode *next = v->n->value.node; next != 0 && count < cap;
+       next = next->next) {
+    if (EKON_UNLIKELY(next->ekonType != EKON_TYPE_NUMBER))
+      break;
+    if (EKON_UNLIKELY(ekonNodeNumInt(next, INT64_MIN, INT64_MAX,
+                                     out + count) == false))
+      break;
+    count++;
+  }
+  return count;
+}
+
 EkonValue *ekonValueBegin(const EkonValue *v) {
   if (EKON_UNLIKELY(v->n == 0))
     return 0;
@@ -3530,6 +8018,9 @@ bool ekonValueCopyFrom(EkonValue *desV, const EkonValue *srcV) {
 
   do {
     desNode->ekonType = node->ekonType;
+    // with the number it has decoded, if any (EKON_IS_NUM_CACHED)
+    desNode->option = node->option;
+    desNode->num = node->num;
 
     // ----- key copy -----
     if (node->key != 0) {
@@ -3541,26 +8032,19 @@ bool ekonValueCopyFrom(EkonValue *desV, const EkonValue *srcV) {
       ekonCopy(node->key, node->keyLen, k);
       desNode->key = k;
       desNode->keyLen = node->keyLen;
+      desNode->keyHash = node->keyHash;
+      desNode->keyId = 0;
     } else
       desNode->key = 0;
     // -------------------
 
-    // yeah. we have also put up with this shit!
-    EkonNode *father = desNode->father;
+    // the copy of an object gets its keymap on its first lookup
     desNode->hashItem = NULL;
-    if (father != 0 && father->ekonType == EKON_TYPE_OBJECT) {
-      desNode->hashItem =
-          (EkonHashmapItem *)ekonAllocatorAlloc(a, sizeof(EkonHashmapItem));
-      ekonHashmapPut(a, father->keymap, desNode->key, desNode->keyLen, desNode,
-                     &desNode->hashItem);
-    }
+    desNode->keymap = 0;
 
     switch (node->ekonType) {
-    case EKON_TYPE_OBJECT: {
-      if (ekonHashmapInit(a, node->keymap->size, desNode->keymap) == false)
-        return false;
+    case EKON_TYPE_OBJECT:
       // moving on to the case EKON_TYPE_ARRAY ...
-    }
     case EKON_TYPE_ARRAY: {
       desNode->len = node->len;
       if (EKON_LIKELY(node->value.node != 0)) {
@@ -3632,26 +8116,20 @@ bool ekonValueMoveOutOfArrObj(EkonValue *v) {
   if (v->n->father != 0) {
     EkonNode *n = v->n;
     EkonNode *father = v->n->father;
-    if (n->prev == 0) {
+    if (n->prev == 0)
       father->value.node = n->next;
-    } else {
+    else
       n->prev->next = n->next;
-      n->prev = 0;
-    }
 
-    if (n->next == 0) {
-      n->father->end = n->prev;
-    } else {
+    if (n->next == 0)
+      father->end = n->prev;
+    else
       n->next->prev = n->prev;
-      n->next = 0;
-    }
-
-    if (father->ekonType == EKON_TYPE_OBJECT) {
-      if (ekonHashmapRemove(father->keymap, n->key, n->keyLen) == false)
-        return false;
+    n->prev = 0;
+    n->next = 0;
 
-      n->hashItem = NULL;
-    }
+    if (father->ekonType == EKON_TYPE_OBJECT)
+      ekonNodeKeymapRemove(father, n);
 
     --(father->len);
     n->father = 0;
@@ -3669,6 +8147,7 @@ bool ekonValueSetNull(EkonValue *v) {
     v->n->father = 0;
     v->n->next = 0;
   }
+  v->n->option = 0;
   v->n->ekonType = EKON_TYPE_NULL;
   v->n->value.str = ekonStrNull;
   v->n->len = 4;
@@ -3685,6 +8164,7 @@ bool ekonValueSetBool(EkonValue *v, bool b) {
     v->n->father = 0;
     v->n->next = 0;
   }
+  v->n->option = 0;
   v->n->ekonType = EKON_TYPE_BOOL;
   if (b == false) {
     v->n->value.str = ekonStrFalse;
@@ -3710,6 +8190,7 @@ bool ekonValueSetNumStrFast(EkonValue *v, const char *num) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = 0;
   v->n->value.str = num;
   v->n->len = len;
   return true;
@@ -3728,6 +8209,7 @@ bool ekonValueSetNumStrLenFast(EkonValue *v, const char *num, u32 len) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = 0;
   v->n->value.str = num;
   v->n->len = len;
   return true;
@@ -3751,6 +8233,7 @@ bool ekonValueSetNumStr(EkonValue *v, const char *num) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = 0;
   v->n->value.str = s;
   v->n->len = len;
   return true;
@@ -3773,6 +8256,7 @@ bool ekonValueSetNumStrLen(EkonValue *v, const char *num, u32 len) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = 0;
   v->n->value.str = s;
   v->n->len = len;
   return true;
@@ -3793,6 +8277,8 @@ bool ekonValueSetDouble(EkonValue *v, const f64 d) {
     v->n->father = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = EKON_IS_NUM_FLOAT | EKON_IS_NUM_CACHED;
+  v->n->num.d = d;
   v->n->value.str = num;
   v->n->len = len;
   return true;
@@ -3817,6 +8303,8 @@ bool ekonValueSetInt(EkonValue *v, const int n) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = EKON_IS_NUM_INT | EKON_IS_NUM_CACHED;
+  v->n->num.i = n;
   v->n->value.str = num;
   v->n->len = len;
   return true;
@@ -3837,6 +8325,8 @@ bool ekonValueSetLong(EkonValue *v, const long l) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = EKON_IS_NUM_INT | EKON_IS_NUM_CACHED;
+  v->n->num.i = l;
   v->n->value.str = num;
   v->n->len = len;
   return true;
@@ -3857,6 +8347,8 @@ bool ekonValueSetLongLong(EkonValue *v, const long long ll) {
     v->n->next = 0;
   }
   v->n->ekonType = EKON_TYPE_NUMBER;
+  v->n->option = EKON_IS_NUM_INT | EKON_IS_NUM_CACHED;
+  v->n->num.i = ll;
   v->n->value.str = num;
   v->n->len = len;
   return true;
@@ -3871,7 +8363,8 @@ bool ekonValueSetStrEscape(EkonValue *v, const char *str) {
 }
 
 bool ekonValueSetStrLenEscape(EkonValue *v, const char *str, u32 len) {
-  const char *es = ekonEscapeStrLen(str, v->a, len);
+  u32 finalLen;
+  const char *es = ekonEscapeStrLen(str, v->a, len, &finalLen);
   if (EKON_UNLIKELY(es == 0))
     return false;
   return ekonValueSetStrFast(v, es);
@@ -3900,7 +8393,7 @@ bool ekonValueSetStrFast(EkonValue *v, const char *str) {
 }
 
 bool ekonValueSetStrLenFast(EkonValue *v, const char *str, u32 len) {
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStrLen(v->a, str, len, &option) == false))
     return false;
 
@@ -3922,7 +8415,7 @@ bool ekonValueSetStrLenFast(EkonValue *v, const char *str, u32 len) {
 
 bool ekonValueSetStr(EkonValue *v, const char *str) {
   u32 len = 0;
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStr(str, &len, &option) == false))
     return false;
   char *s = ekonAllocatorAlloc(v->a, len);
@@ -3939,7 +8432,7 @@ bool ekonValueSetStr(EkonValue *v, const char *str) {
 }
 
 bool ekonValueSetStrLen(EkonValue *v, const char *str, u32 len) {
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStrLen(v->a, str, len, &option) == false))
     return false;
 
@@ -3973,7 +8466,8 @@ bool ekonValueSetKeyEscape(EkonValue *v, const char *key) {
 }
 
 bool ekonValueSetKeyLenEscape(EkonValue *v, const char *key, u32 len) {
-  const char *es = ekonEscapeStrLen(key, v->a, len);
+  u32 finalLen;
+  const char *es = ekonEscapeStrLen(key, v->a, len, &finalLen);
   if (EKON_UNLIKELY(es == 0))
     return false;
   return ekonValueSetKeyFast(v, es);
@@ -3981,7 +8475,7 @@ bool ekonValueSetKeyLenEscape(EkonValue *v, const char *key, u32 len) {
 
 bool ekonValueSetKeyFast(EkonValue *v, const char *key) {
   u32 len = 0;
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStr(key, &len, &option) == false))
     return false;
 
@@ -3999,28 +8493,19 @@ bool ekonValueSetKeyFast(EkonValue *v, const char *key) {
     n->ekonType = EKON_TYPE_NULL;
     n->value.str = ekonStrNull;
     n->len = 4;
-    n->hashItem =
-        (EkonHashmapItem *)ekonAllocatorAlloc(v->a, sizeof(EkonHashmapItem));
-  } else {
-    EkonNode *father = v->n->father;
-    if (father != 0 && father->ekonType == EKON_TYPE_OBJECT) {
-      if (ekonHashmapPut(v->a, v->n->keymap, key, len, NULL, NULL) == false)
-        return false;
-    }
+    n->key = 0;
+    n->option = 0;
   }
 
-  EkonNode *n = v->n;
-
-  n->hashItem->key = key;
-  n->hashItem->keyLen = len;
-  n->key = key;
-  n->keyLen = len;
-  n->option = ekonValueOptionStrToKey(option);
+  if (ekonNodeSetKey(v->a, v->n, key, len) == false)
+    return false;
+  v->n->option = (v->n->option & ~EKON_KEY_OPTIONS) |
+                  ekonValueOptionStrToKey(option);
   return true;
 }
 
 bool ekonValueSetKeyLenFast(EkonValue *v, const char *key, u32 len) {
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStrLen(v->a, key, len, &option) == false))
     return false;
 
@@ -4037,28 +8522,20 @@ bool ekonValueSetKeyLenFast(EkonValue *v, const char *key, u32 len) {
     v->n->ekonType = EKON_TYPE_NULL;
     v->n->value.str = ekonStrNull;
     v->n->len = 4;
-  } else if (v->n->father != 0 &&
-             EKON_UNLIKELY(v->n->father->ekonType != EKON_TYPE_OBJECT)) {
-    EkonNode *father = v->n->father;
-    if (father != 0 && father->ekonType == EKON_TYPE_OBJECT) {
-      if (ekonHashmapPut(v->a, v->n->keymap, key, len, NULL, NULL) == false)
-        return false;
-    }
+    v->n->key = 0;
+    v->n->option = 0;
   }
 
-  EkonNode *n = v->n;
-
-  n->hashItem->key = key;
-  n->hashItem->keyLen = len;
-  n->key = key;
-  n->keyLen = len;
-  n->option = option;
+  if (ekonNodeSetKey(v->a, v->n, key, len) == false)
+    return false;
+  v->n->option = (v->n->option & ~EKON_KEY_OPTIONS) |
+                  ekonValueOptionStrToKey(option);
   return true;
 }
 
 bool ekonValueSetKey(EkonValue *v, const char *key) {
   u32 len = 0;
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStr(key, &len, &option) == false))
     return false;
 
@@ -4075,6 +8552,8 @@ bool ekonValueSetKey(EkonValue *v, const char *key) {
     v->n->ekonType = EKON_TYPE_NULL;
     v->n->value.str = ekonStrNull;
     v->n->len = 4;
+    v->n->key = 0;
+    v->n->option = 0;
   } else if (v->n->father != 0 &&
              EKON_UNLIKELY(v->n->father->ekonType != EKON_TYPE_OBJECT))
     return false;
@@ -4083,9 +8562,10 @@ bool ekonValueSetKey(EkonValue *v, const char *key) {
   if (EKON_UNLIKELY(s == 0))
     return false;
   ekonCopy(key, len, s);
-  v->n->option = option;
-  v->n->key = s;
-  v->n->keyLen = len;
+  if (ekonNodeSetKey(v->a, v->n, s, len) == false)
+    return false;
+  v->n->option = (v->n->option & ~EKON_KEY_OPTIONS) |
+                  ekonValueOptionStrToKey(option);
   return true;
 }
 
@@ -4093,7 +8573,7 @@ bool ekonValueSetKey(EkonValue *v, const char *key) {
 bool ekonValueSetKeyLen(EkonValue *v, const char *key, u32 len) {
   if (len == 0)
     return false;
-  EkonOption option;
+  EkonOption option = 0;
   if (EKON_UNLIKELY(ekonCheckStrLen(v->a, key, len, &option) == false))
     return false;
 
@@ -4107,6 +8587,8 @@ bool ekonValueSetKeyLen(EkonValue *v, const char *key, u32 len) {
     v->n->ekonType = EKON_TYPE_NULL;
     v->n->value.str = ekonStrNull;
     v->n->len = 4;
+    v->n->key = 0;
+    v->n->option = 0;
   } else if (v->n->father != 0 &&
              EKON_UNLIKELY(v->n->father->ekonType != EKON_TYPE_OBJECT))
     return false;
@@ -4115,9 +8597,10 @@ bool ekonValueSetKeyLen(EkonValue *v, const char *key, u32 len) {
   if (EKON_UNLIKELY(s == 0))
     return false;
   ekonCopy(key, len, s);
-  v->n->option = option;
-  v->n->key = s;
-  v->n->keyLen = len;
+  if (ekonNodeSetKey(v->a, v->n, s, len) == false)
+    return false;
+  v->n->option = (v->n->option & ~EKON_KEY_OPTIONS) |
+                  ekonValueOptionStrToKey(option);
   return true;
 }
 
@@ -4146,10 +8629,8 @@ bool ekonValueSetObj(EkonValue *v) {
     v->n->prev = 0;
     v->n->father = 0;
     v->n->next = 0;
-    v->n->keymap = (EkonHashmap *)ekonAllocatorAlloc(v->a, sizeof(EkonHashmap));
   }
-  if (ekonHashmapInit(v->a, 8, v->n->keymap) == false)
-    return false;
+  v->n->keymap = 0;
   v->n->ekonType = EKON_TYPE_OBJECT;
   v->n->value.node = 0;
   v->n->len = 0;
@@ -4170,23 +8651,15 @@ bool ekonValueSetFast(EkonValue *desV, EkonValue *srcV) {
   EkonNode *srcN = srcV->n;
 
   desN->ekonType = srcN->ekonType;
-  if (desN->key != 0 && srcN->key != 0) {
-    desN->key = srcN->key;
-    desN->keyLen = srcN->keyLen;
-  }
+  if (desN->key != 0 && srcN->key != 0 &&
+      ekonNodeSetKey(desV->a, desN, srcN->key, srcN->keyLen) == false)
+    return false;
 
   desN->value = srcN->value;
   desN->len = srcN->len;
 
-  if (srcN->father != 0 && desN->father != 0 &&
-      srcN->father->ekonType == EKON_TYPE_OBJECT &&
-      desN->father->ekonType == EKON_TYPE_OBJECT) {
-    srcN->hashItem = desN->hashItem;
-  }
-
   if (desN->ekonType == EKON_TYPE_ARRAY || desN->ekonType == EKON_TYPE_OBJECT) {
-    if (desN->keymap != 0 && srcN->keymap != 0)
-      desN->keymap = srcN->keymap;
+    desN->keymap = srcN->keymap;
 
     desN->end = srcN->end;
     EkonNode *next = desN->value.node;
@@ -4208,15 +8681,15 @@ bool ekonValueSet(EkonValue *desV, const EkonValue *srcV) {
     return true;
   }
   desV->n->ekonType = cp->n->ekonType;
-  if (desV->n->key != 0 && srcV->n->key != 0) {
-    desV->n->key = cp->n->key;
-    desV->n->keyLen = cp->n->keyLen;
-  }
+  if (desV->n->key != 0 && srcV->n->key != 0 &&
+      ekonNodeSetKey(desV->a, desV->n, cp->n->key, cp->n->keyLen) == false)
+    return false;
   desV->n->value = cp->n->value;
   desV->n->len = cp->n->len;
   if (desV->n->ekonType == EKON_TYPE_ARRAY ||
       desV->n->ekonType == EKON_TYPE_OBJECT) {
-    desV->n->end = srcV->n->end;
+    desV->n->keymap = cp->n->keymap;
+    desV->n->end = cp->n->end;
     EkonNode *next = desV->n->value.node;
     while (EKON_LIKELY(next != 0)) {
       next->father = desV->n;
@@ -4241,11 +8714,8 @@ bool ekonValueObjAddFast(EkonValue *objV, EkonValue *childV) {
     return false;
 
   childV->n->father = objV->n;
-  if (ekonHashmapPut(objV->a, objV->n->keymap, childV->n->key,
-                     childV->n->keyLen, childV->n,
-                     &childV->n->hashItem) == false) {
+  if (ekonNodeKeymapAdd(objV->a, objV->n, childV->n) == false)
     return false;
-  }
 
   if (EKON_UNLIKELY(objV->n->value.node == 0)) {
     objV->n->value.node = childV->n;
@@ -4277,11 +8747,8 @@ bool ekonValueObjAdd(EkonValue *objV, const EkonValue *childV) {
 
   if (childV->n->keyLen == 0)
     return false;
-  if (ekonHashmapPut(objV->a, objV->n->keymap, childV->n->key,
-                     childV->n->keyLen, childV->n,
-                     &childV->n->hashItem) == false) {
+  if (ekonNodeKeymapAdd(objV->a, objV->n, cp->n) == false)
     return false;
-  }
   if (EKON_UNLIKELY(objV->n->value.node == 0)) {
     objV->n->value.node = cp->n;
     objV->n->len = 1;
@@ -4355,6 +8822,17 @@ bool ekonValueObjDel(EkonValue *v, const char *key) {
   return ekonValueMoveOutOfArrObj(dv);
 }
 
+bool ekonValueObjDelPrepared(EkonValue *v, const EkonKey *key) {
+  if (EKON_UNLIKELY(v->n == 0 || v->n->ekonType != EKON_TYPE_OBJECT))
+    return false;
+  EkonValue dv;
+  dv.a = v->a;
+  dv.n = ekonNodeObjFindHashed(v->a, v->n, key->key, key->len, key->hash);
+  if (EKON_UNLIKELY(dv.n == 0))
+    return false;
+  return ekonValueMoveOutOfArrObj(&dv);
+}
+
 /**
  * @brief provide `key`, `keyLen` and get objNode
  * @param objNode the object node whose field is the outNode
@@ -4367,7 +8845,7 @@ bool ekonValueObjDel(EkonValue *v, const char *key) {
  * */
 bool ekonValueGetValue(EkonValue *objNode, const char *key, const u32 keyLen,
                        EkonNode **outValue) {
-  *outValue = ekonHashmapGet(objNode->n->keymap, key, keyLen);
+  *outValue = ekonNodeObjFind(objNode->a, objNode->n, key, keyLen);
   if (*outValue == NULL)
     return false;
   return true;
@@ -21,12 +21,30 @@
 // ------ Type Macros Rust like --------
 #define i8 int8_t
 #define i32 int
+#define i64 int64_t
 #define u8 uint8_t
 #define u16 uint16_t
 #define u32 uint32_t
 #define f64 double
 
 #define EkonOption uint16_t
+
+// ------ Input padding --------
+// bytes past `s + len` that ekonValueParseLen may read. the default of 0 keeps
+// every read inside the source. builds that always leave this many readable
+// bytes after their sources can raise it (e.g. to 32), so that the vectorized
+// scanners finish the last block with a vector load instead of byte by byte
+#ifndef EKON_PADDING
+#define EKON_PADDING 0
+#endif
+
+// ------ Heap memory --------
+// 1: the library takes its heap memory with malloc. 2: the same, counted
+// (see ekonMemoryStats), to check that a workload does not go to the heap.
+// the counts are not atomic, so only single-threaded work is counted exactly
+#ifndef EKON_MEMORY_NODE
+#define EKON_MEMORY_NODE 1
+#endif
 // ----------------------------------------------------------
 // 1. Type Definitions and Declarations
 // ----------------------------------------------------------
@@ -61,7 +79,11 @@ typedef enum {
   EKON_IS_NUM_DECIMAL = 1 << 8,
   EKON_IS_NUM_HEXADECIMAL = 1 << 9,
   EKON_IS_NUM_FLOAT = 1 << 10,
-  EKON_IS_NUM_INT = 1 << 11
+  EKON_IS_NUM_INT = 1 << 11,
+  // `num` of the node holds the decoded number
+  EKON_IS_NUM_CACHED = 1 << 12,
+  // an integer literal outside the range of an i64, cached as a double
+  EKON_IS_NUM_OVERFLOW = 1 << 13
 } EKON_NODE_OPTIONS;
 
 // Node for allocator
@@ -73,26 +95,50 @@ struct _EkonANode {
 };
 typedef struct _EkonANode EkonANode;
 
+// Shared table of object keys - see ekonKeyTableNew
+typedef struct _EkonKeyTable EkonKeyTable;
+
 // Memory Allocator (!!)
 struct _EkonAllocator {
   EkonANode *root;
   EkonANode *end;
+  EkonKeyTable *keys; // keys of the documents parsed here, see ekonKeyTableNew
+  // scratch copy of the strings the setters check, in the blocks above. it
+  // goes with them when the allocator is reset
+  struct _EkonString *scratch;
 };
 typedef struct _EkonAllocator EkonAllocator;
 
+// Blocks an allocator keeps when it is reset - see ekonAllocatorReset
+typedef enum {
+  // the first block and the largest one. a run of similar documents stops
+  // going to malloc after the first few
+  EKON_RESET_KEEP_LARGEST = 0,
+  // every block, the high-water mark of the traffic so far. they are handed
+  // out again in order
+  EKON_RESET_KEEP_ALL,
+  // only the first block, as ekonAllocatorNew gives it
+  EKON_RESET_KEEP_FIRST
+} EkonResetPolicy;
+
 // Hashmap-Item
 struct hashmap_element_s {
   const char *key;
   u32 keyLen;
-  bool inUse;
+  u32 hash; // compared before the key bytes, and reused by rehashes
   struct _EkonNode *value;
 };
 typedef struct hashmap_element_s EkonHashmapItem;
 
-// Hash-Map
+// Hash-Map. open addressing over groups of 16 slots, probed with one SIMD
+// compare of their control bytes (empty, deleted, or 7 bits of the hash)
 struct hashmap_s {
-  u32 tableSize;         // max size
+  u32 tableSize;         // number of slots, a power of 2
   u32 size;              // current size
+  u32 growthLeft;        // empty slots that can be used before a rehash
+  u32 shadowed; // members hidden by a later one with the same key, see
+                // ekonNodeKeymapRemove
+  u8 *ctrl;              // control byte of each slot
   EkonHashmapItem *data; // array of HashmapItem
 };
 typedef struct hashmap_s EkonHashmap;
@@ -100,9 +146,10 @@ typedef struct hashmap_s EkonHashmap;
 // EKON Node
 struct _EkonNode {
   EkonType ekonType;
-  uint8_t option;
+  EkonOption option;
   const char *key;
   u32 keyLen;
+  u32 keyHash; // hash of key (see ekonHashmapHash), set along with it
 
   EkonHashmap *keymap; // duplicate prevention & faster retrieval of objects
 
@@ -114,7 +161,14 @@ struct _EkonNode {
     struct _EkonNode *node;
     const char *str;
   } value;
-  u32 len; // string length
+  u32 len;   // string length
+  u32 keyId; // id of the key in the key table it was parsed with, 0 if none
+  // decoded number, filled on the first numeric read (EKON_IS_NUM_CACHED).
+  // `d` for EKON_IS_NUM_FLOAT, `i` for the other EKON_IS_NUM_* kinds
+  union {
+    i64 i;
+    f64 d;
+  } num;
   struct _EkonNode *next;
   struct _EkonNode *prev;
   struct _EkonNode *father;
@@ -137,6 +191,28 @@ typedef struct EkonBeautifyOptions {
   bool preserveComments;
 } EkonBeautifyOptions;
 
+// When the numbers of a document are decoded - see EkonParseOptions
+typedef enum {
+  // checked while parsing, decoded on their first numeric read
+  EKON_NUMBERS_LAZY = 0,
+  // decoded while parsing, so reads only test a flag. a number that does not
+  // decode fails the parse
+  EKON_NUMBERS_EAGER
+} EkonNumberPolicy;
+
+// Options of ekonValueParseEx. zeroed options parse like ekonValueParseLen
+typedef struct EkonParseOptions {
+  // for trusted producers: duplicate keys are not looked for and no keymap
+  // is built while parsing. a lookup of a repeated key finds its last member
+  bool allowDuplicateKeys;
+  // the backtick schema is skipped without being copied to outSchema
+  bool skipSchema;
+  u32 maxDepth;  // deepest nesting of arrays and objects, 0 for no limit
+  u32 maxLen;    // longest source, 0 for no limit
+  u32 maxValues; // most values in the document, 0 for no limit
+  EkonNumberPolicy numbers;
+} EkonParseOptions;
+
 // Ekon String
 struct _EkonString {
   char *data;
@@ -146,6 +222,46 @@ struct _EkonString {
 };
 typedef struct _EkonString EkonString;
 
+// Incremental parser - see ekonParserNew
+typedef struct _EkonParser EkonParser;
+
+// Event handler for ekonSaxParseLen. any callback may be NULL. keys, strings
+// and numbers are views into the source, with their EKON_NODE_OPTIONS bits.
+// a callback returning false stops the parse
+typedef struct _EkonSaxHandler {
+  void *ctx; // passed to every callback
+  bool (*startObject)(void *ctx);
+  bool (*endObject)(void *ctx);
+  bool (*startArray)(void *ctx);
+  bool (*endArray)(void *ctx);
+  bool (*key)(void *ctx, const char *key, u32 len, EkonOption option);
+  bool (*string)(void *ctx, const char *s, u32 len, EkonOption option);
+  bool (*number)(void *ctx, const char *s, u32 len, EkonOption option);
+  bool (*boolean)(void *ctx, bool b);
+  bool (*null)(void *ctx);
+} EkonSaxHandler;
+
+// Documents one after the other in a source - see ekonDocStreamNew
+typedef struct _EkonDocStream EkonDocStream;
+
+// On-demand cursor - see ekonCursorInit. a plain value that can be copied to
+// keep a position
+struct _EkonCursor {
+  const char *s;
+  u32 len;
+  u32 index;      // first char of the current value
+  bool isRootObj; // the current value is a root object without curly braces
+};
+typedef struct _EkonCursor EkonCursor;
+
+// Key prepared for repeated object lookups - see ekonKeyPrepare
+struct _EkonKey {
+  const char *key;
+  u32 len;
+  u32 hash; // hash of the key, as the keymaps of the objects use it
+};
+typedef struct _EkonKey EkonKey;
+
 static const u32 ekonDelta = 2;
 static const u32 ekonAllocatorInitMemSize = 1024 * 4;
 static const u32 ekonStringInitMemSize = 1024;
@@ -175,6 +291,28 @@ char *ekonAllocatorAlloc(EkonAllocator *a, u32 size);
  * */
 void ekonAllocatorRelease(EkonAllocator *rootAlloc);
 
+/**
+ * @brief Rewind an allocator so that its memory is handed out again, e.g.
+ *        between the requests of a server. everything allocated from it
+ *        before, values and strings, is gone. its key table stays
+ * @param alloc   Allocator to reset
+ * @param policy  blocks kept for the next use, the others are freed
+ * */
+void ekonAllocatorReset(EkonAllocator *alloc, EkonResetPolicy policy);
+
+#if EKON_MEMORY_NODE == 2
+/**
+ * @brief Heap blocks taken and given back by the library so far: the blocks
+ *        of allocators, error messages, schemas...
+ * @param outAllocCount   number of blocks taken
+ * @param outAllocSize    bytes taken
+ * @param outFreeCount    number of blocks given back. messages and schemas
+ *                        are freed by the caller, they are not counted
+ * */
+void ekonMemoryStats(u32 *outAllocCount, u32 *outAllocSize,
+                     u32 *outFreeCount);
+#endif
+
 /**
  * @brief Initialize Value using allocator
  * @param alloc EkonAllocator used for allocation
@@ -224,6 +362,11 @@ bool ekonValueParseFast(EkonValue *v, const char *s, char **outErrMess,
 /**
  * @brief             The parser for Ekon String but with known length
  *                      Prefer this over ekonValueParseFast
+ *                    `s` is parsed in place and does not need a terminating
+ *                    '\0', so slices of larger buffers (network reads, mmapped
+ *                    files) can be parsed without a copy. no byte past
+ *                    `s + len + EKON_PADDING` is read. parsed strings point
+ *                    into `s`, which has to outlive `v`
  * @param v           EkonValue where the parsed whole node is stored
  * @param s           EKON Source code string
  * @param len         source code string length
@@ -251,6 +394,270 @@ bool ekonValueParseLen(EkonValue *v, const char *s, u32 len, char **outErrMess,
 bool ekonValueParse(EkonValue *v, const char *s, char **outErrMess,
                     char **outSchema);
 
+/**
+ * @brief             ekonValueParseLen with options, see EkonParseOptions
+ * @param v           EkonValue where the parsed whole node is stored
+ * @param s           EKON Source code string
+ * @param len         source code string length
+ * @param options     the options, NULL for the defaults
+ * @param outErrMess  the pointer to errMessage char-array. NULL to not build
+ *                    a message
+ * @param outSchema   the pointer to the schema char-array, see
+ *                    ekonValueParseLen. NULL like options->skipSchema
+ * @return            true for success, false for failure
+ * */
+bool ekonValueParseEx(EkonValue *v, const char *s, u32 len,
+                      const EkonParseOptions *options, char **outErrMess,
+                      char **outSchema);
+
+/**
+ * @brief             Parse a large root array or object with several threads.
+ *                    its values are split into runs of about the same length
+ *                    that are parsed at the same time and linked together.
+ *                    strings of the values point into a copy of `s` kept in
+ *                    the allocator of `v`. other and small sources, as well
+ *                    as sources with errors, are left to ekonValueParseLen.
+ *                    link with -pthread
+ * @param v           EkonValue where the parsed whole node is stored
+ * @param s           EKON Source code string
+ * @param len         source code string length
+ * @param threads     number of threads, 0 for one per core. builds with
+ *                    EKON_NO_THREADS parse the runs one after the other
+ * @param outErrMess  the pointer to errMessage char-array
+ * @param outSchema   the pointer to the schema char-array. see
+ *                    ekonValueParseLen
+ * @return            true for success, false for failure
+ * */
+bool ekonValueParseParallel(EkonValue *v, const char *s, u32 len, u32 threads,
+                            char **outErrMess, char **outSchema);
+
+/**
+ * @brief             Incremental parser for sources that arrive in chunks
+ *                    (sockets, pipes). feed it the chunks as they come with
+ *                    ekonParserFeed and end with ekonParserFinish. tokens cut
+ *                    by the end of a chunk wait for the next one, everything
+ *                    before them is parsed right away. the parser and the
+ *                    copies of the chunks live in the allocator of `v`
+ * @param v           EkonValue where the parsed whole node is stored
+ * @return            the parser, NULL if out of memory
+ * */
+EkonParser *ekonParserNew(EkonValue *v);
+
+/**
+ * @brief             Parse the next chunk of the source. the chunk is copied
+ *                    and can be reused as soon as this returns
+ * @param p           the parser
+ * @param chunk       the next bytes of the source
+ * @param len         length of the chunk
+ * @param outErrMess  the pointer to errMessage char-array
+ * @param outSchema   the pointer to the schema char-array. see
+ *                    ekonValueParseLen
+ * @return            false once the source is known to be invalid
+ * */
+bool ekonParserFeed(EkonParser *p, const char *chunk, u32 len,
+                    char **outErrMess, char **outSchema);
+
+/**
+ * @brief             End of the source. parses what is left, after which `v`
+ *                    holds what ekonValueParseLen would have given for the
+ *                    whole source
+ * @param p           the parser
+ * @param outErrMess  the pointer to errMessage char-array
+ * @param outSchema   the pointer to the schema char-array
+ * @return            true for success, false for failure
+ * */
+bool ekonParserFinish(EkonParser *p, char **outErrMess, char **outSchema);
+
+/**
+ * @brief             Event parser. reports the values of `s` to the callbacks
+ *                    of `h` in source order instead of building EkonNodes. only
+ *                    the schema is allocated. it uses the same lexer as
+ *                    ekonValueParseLen and accepts the same sources, except
+ *                    that duplicate keys are not looked for and arrays/objects
+ *                    nest at most EKON_SAX_MAX_DEPTH (1024) deep
+ * @param s           EKON Source code string, does not need a '\0'
+ * @param len         source code string length
+ * @param h           the callbacks
+ * @param outErrMess  the pointer to errMessage char-array. not set when a
+ *                    callback stopped the parse
+ * @param outSchema   the pointer to the schema char-array. see
+ *                    ekonValueParseLen
+ * @return            true for success, false for failure
+ * */
+bool ekonSaxParseLen(const char *s, u32 len, const EkonSaxHandler *h,
+                     char **outErrMess, char **outSchema);
+
+/**
+ * @brief             On-demand cursor. points `cur` at the root value of `s`
+ *                    without parsing it. ekonCursorFindField and
+ *                    ekonCursorArrayAt move it down to the values asked for,
+ *                    skipping the ones in between, and ekonCursorGet parses
+ *                    only the value it ends up at. a copy of a cursor keeps
+ *                    its position, e.g. to look up several fields of one
+ *                    object. `s` has to outlive the cursor
+ * @param cur         the cursor
+ * @param s           EKON Source code string, does not need a '\0'
+ * @param len         source code string length
+ * @param outErrMess  the pointer to errMessage char-array
+ * @param outSchema   the pointer to the schema char-array. see
+ *                    ekonValueParseLen
+ * @return            false if there is no root value
+ * */
+bool ekonCursorInit(EkonCursor *cur, const char *s, u32 len, char **outErrMess,
+                    char **outSchema);
+
+/**
+ * @brief             Move a cursor at an object to the value of `key`. the
+ *                    fields before it are skipped with a bracket count and
+ *                    are not checked any further
+ * @param cur         the cursor. left as it is when false is returned
+ * @param key         key to be looked up, as written in the source
+ * @return            false if the value is not an object or has no `key`
+ * */
+bool ekonCursorFindField(EkonCursor *cur, const char *key);
+
+/**
+ * @brief             ekonCursorFindField for a key of known length
+ * @param cur         the cursor. left as it is when false is returned
+ * @param key         key to be looked up, as written in the source
+ * @param keyLen      length of the key
+ * @return            false if the value is not an object or has no `key`
+ * */
+bool ekonCursorFindFieldLen(EkonCursor *cur, const char *key, u32 keyLen);
+
+/**
+ * @brief             Move a cursor at an array to its element `i`
+ * @param cur         the cursor. left as it is when false is returned
+ * @param i           index of the element
+ * @return            false if the value is not an array or is too short
+ * */
+bool ekonCursorArrayAt(EkonCursor *cur, u32 i);
+
+/**
+ * @brief             Parse the value a cursor is at into `v`, as
+ *                    ekonValueParseLen would. for arrays and objects, the
+ *                    positions in an error message are relative to the start
+ *                    of the value
+ * @param cur         the cursor
+ * @param v           EkonValue where the value is stored
+ * @param outErrMess  the pointer to errMessage char-array
+ * @return            true for success, false for failure
+ * */
+bool ekonCursorGet(const EkonCursor *cur, EkonValue *v, char **outErrMess);
+
+/**
+ * @brief             Stream over a source of several documents: one per line
+ *                    (newline-delimited), or simply one after the other. a
+ *                    document in brackets ends with its closing bracket, any
+ *                    other (a scalar, a root object without curly braces) with
+ *                    the end of its line, a comment at the end of the line
+ *                    included. the boundaries are found with a bracket count
+ *                    when a document is not on a line of its own, and all
+ *                    the documents share one allocator that is rewound in
+ *                    between. `s` has to outlive the stream
+ * @param s           EKON Source code string, does not need a '\0'
+ * @param len         source code string length
+ * @return            the stream, NULL if out of memory
+ * */
+EkonDocStream *ekonDocStreamNew(const char *s, u32 len);
+
+/**
+ * @brief             Parse the next document. the value it gives lives until
+ *                    the next call or ekonDocStreamRelease
+ * @param ds          the stream
+ * @param outV        the document, NULL if it is invalid
+ * @param outStart    index of the first byte of the document in `s`
+ * @param outLen      length of the document
+ * @param outErrMess  the pointer to errMessage char-array. positions in it are
+ *                    relative to the document
+ * @param outSchema   the pointer to the schema char-array. see
+ *                    ekonValueParseLen
+ * @return            false once there are no documents left
+ * */
+bool ekonDocStreamNext(EkonDocStream *ds, EkonValue **outV, u32 *outStart,
+                       u32 *outLen, char **outErrMess, char **outSchema);
+
+/**
+ * @brief             Release a stream and the memory of its documents
+ * @param ds          the stream
+ * */
+void ekonDocStreamRelease(EkonDocStream *ds);
+
+/**
+ * @brief             Parse the documents of a stream with a key table (see
+ *                    ekonKeyTableNew), NULL for none
+ * @param ds          the stream
+ * @param t           the key table
+ * */
+void ekonDocStreamSetKeyTable(EkonDocStream *ds, EkonKeyTable *t);
+
+/**
+ * @brief             Create a key table: a symbol table of object keys for
+ *                    documents that repeat the same keys, like the records of
+ *                    a stream. the key of a member parsed with the table gets
+ *                    a stable id (see ekonValueGetKeyId) and points to the
+ *                    bytes of the table, so that matching keys compare by
+ *                    address instead of by bytes. the table learns the keys
+ *                    it has not seen until it holds `maxKeys` of them or is
+ *                    frozen. it can be seeded from a schema or the first
+ *                    documents (see ekonKeyTableAddKeys). a frozen table is
+ *                    only read, and can be shared by threads. it has to
+ *                    outlive the documents parsed with it
+ * @param maxKeys     most keys the table holds
+ * @return            the table, NULL if out of memory
+ * */
+EkonKeyTable *ekonKeyTableNew(u32 maxKeys);
+
+/**
+ * @brief             Add a key to a table, unless it is frozen or full
+ * @param t           the key table
+ * @param key         the key, as it is written in the source (escapes are
+ *                    not decoded)
+ * @param len         length of the key
+ * @return            id of the key, from 1 up. 0 if it is not in the table
+ * */
+u32 ekonKeyTableAdd(EkonKeyTable *t, const char *key, u32 len);
+
+/**
+ * @brief             Find the id of a key
+ * @param t           the key table
+ * @param key         the key
+ * @param len         length of the key
+ * @return            id of the key, 0 if it is not in the table
+ * */
+u32 ekonKeyTableFind(const EkonKeyTable *t, const char *key, u32 len);
+
+/**
+ * @brief             Add the keys of a document and all of its members to a
+ *                    table, e.g. of a sample record or a schema written as
+ *                    EKON
+ * @param t           the key table
+ * @param v           the document
+ * @return            the number of keys the table holds
+ * */
+u32 ekonKeyTableAddKeys(EkonKeyTable *t, const EkonValue *v);
+
+/**
+ * @brief             Stop a table from learning keys: it is only read from
+ *                    then on
+ * @param t           the key table
+ * */
+void ekonKeyTableFreeze(EkonKeyTable *t);
+
+/**
+ * @brief             Release a key table
+ * @param t           the key table
+ * */
+void ekonKeyTableRelease(EkonKeyTable *t);
+
+/**
+ * @brief             Parse the documents of an allocator with a key table
+ *                    (see ekonKeyTableNew), NULL for none
+ * @param a           the allocator
+ * @param t           the key table
+ * */
+void ekonAllocatorSetKeyTable(EkonAllocator *a, EkonKeyTable *t);
+
 /**
  * @brief                 Stringify to pure JSON
  * @param v               The EkonValue to stringify
@@ -316,7 +723,8 @@ const char *ekonValueGetNumFast(const EkonValue *v, u32 *outLen);
 const char *ekonValueGetNumStr(EkonValue *v);
 
 /**
- * @brief Get num (double) directly stored in d
+ * @brief Get num (double) directly stored in d. the first numeric read of a
+ *        node decodes it into the node, later reads only load the result
  * @param v       EkonValue to where the number lies
  * @param d       pointer to the f64 where number is stored
  * @return        success/failure
@@ -332,7 +740,8 @@ const bool ekonValueGetNum(EkonValue *v, f64 *d);
 const bool ekonValueGetf64(EkonValue *v, f64 *d);
 
 /**
- * @brief Get an int directly stored in i
+ * @brief Get an int directly stored in i. floats are truncated, values out of
+ *        the range of int fail
  * @param v       EkonValue to where the number lies
  * @param i       pointer to the int where number is stored
  * @return        success/failure
@@ -340,7 +749,8 @@ const bool ekonValueGetf64(EkonValue *v, f64 *d);
 const bool ekonValueGetInt(EkonValue *v, int *i);
 
 /**
- * @brief Get an long directly stored in l
+ * @brief Get an long directly stored in l. floats are truncated, values out
+ *        of the range of long fail
  * @param v       EkonValue to where the number lies
  * @param l       pointer to the long where number is stored
  * @return        success/failure
@@ -348,7 +758,8 @@ const bool ekonValueGetInt(EkonValue *v, int *i);
 const bool ekonValueGetLong(EkonValue *v, long *l);
 
 /**
- * @brief Get an long long directly stored in ll
+ * @brief Get an long long directly stored in ll. floats are truncated, values
+ *        out of the range of long long fail
  * @param v       EkonValue to where the number lies
  * @param ll      pointer to the long where number is stored
  * @return        success/failure
@@ -396,6 +807,14 @@ const char *ekonValueGetUnEspacedKey(EkonValue *v, u32 *outLen);
  * */
 const char *ekonValueGetKeyFast(const EkonValue *v, u32 *outLen);
 
+/**
+ * @brief Get the id of the key in the key table it was parsed with (see
+ *        ekonKeyTableNew)
+ * @param v       EkonValue of an object member
+ * @return        the id, 0 without a key or if it is not in the table
+ * */
+u32 ekonValueGetKeyId(const EkonValue *v);
+
 /**
  * @brief Get a value from an object with a key without len
  * @param v       EkonValue where the node is present
@@ -413,6 +832,24 @@ EkonValue *ekonValueObjGet(const EkonValue *v, const char *key);
  * */
 EkonValue *ekonValueObjGetLen(const EkonValue *v, const char *key, u32 keyLen);
 
+/**
+ * @brief Prepare a key for lookups that repeat: its length and hash are
+ *        computed once here instead of on every lookup
+ * @param key     string character key. not copied, it has to outlive the
+ *                handle
+ * @param keyLen  key length
+ * @return        the handle, see ekonValueObjGetPrepared
+ * */
+EkonKey ekonKeyPrepare(const char *key, u32 keyLen);
+
+/**
+ * @brief Get a value from an object with a prepared key
+ * @param v       EkonValue where the node is present
+ * @param key     the key, see ekonKeyPrepare
+ * @return        EkonValue with the node as the inner value
+ * */
+EkonValue *ekonValueObjGetPrepared(const EkonValue *v, const EkonKey *key);
+
 /**
  * @brief Get the type of a node in the value v
  * @param v       The value containing the inner node
@@ -435,6 +872,31 @@ u32 ekonValueSize(const EkonValue *v);
  * */
 EkonValue *ekonValueArrayGet(const EkonValue *v, u32 index);
 
+/**
+ * @brief Read an array of numbers into a buffer in one pass, without a
+ *        EkonValue per element. like ekonValueGetNum, every element read is
+ *        decoded once and cached in its node
+ * @param v       The EkonValue whose node is an array
+ * @param out     buffer for the numbers
+ * @param cap     number of f64 that fit in out
+ * @return        number of elements written. stops early at cap or at the
+ *                first element that is not a number; compare with
+ *                ekonValueSize to tell the whole array was read
+ * */
+u32 ekonValueArrayGetDoubles(EkonValue *v, f64 *out, u32 cap);
+
+/**
+ * @brief Read an array of integers into a buffer in one pass, like
+ *        ekonValueArrayGetDoubles. floats are truncated as in
+ *        ekonValueGetLongLong
+ * @param v       The EkonValue whose node is an array
+ * @param out     buffer for the numbers
+ * @param cap     number of i64 that fit in out
+ * @return        number of elements written. stops early at cap or at the
+ *                first element that is not a number or out of the i64 range
+ * */
+u32 ekonValueArrayGetInt64s(EkonValue *v, i64 *out, u32 cap);
+
 /**
  * @brief Get the start of a array/object
  * @param v       The EkonValue whose node is an array/object
@@ -745,6 +1207,14 @@ bool ekonValueArrayDel(EkonValue *arrV, u32 index);
  * */
 bool ekonValueObjDel(EkonValue *objV, const char *key);
 
+/*
+ * @brief delete a member in objV with a prepared key (see ekonKeyPrepare)
+ * @param objV      EkonValue whose node is to be updated
+ * @param key       key of the node that is to be removed
+ * @return          success/failure
+ * */
+bool ekonValueObjDelPrepared(EkonValue *objV, const EkonKey *key);
+
 /**
  * @brief provide `key`, `keyLen` and get objNode
  * @param objNode the object node whose field is the outNode
@@ -1,5 +1,6 @@
 #include "ekon.h"
 #include "test.h"
+#include <clocale>
 
 using namespace std;
 
@@ -53,6 +54,1033 @@ void EKONCheckerTest() {
   }
 }
 
+// a length-bounded parse of a slice followed by other bytes has to agree with
+// parsing the same text on its own
+bool ParseSliceOne(const string &json, const string &trail) {
+  string buf = json + trail;
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  bool ret = ekonValueParseLen(v, buf.data(), json.size(), &err, &schema);
+  ekonAllocatorRelease(A);
+  free(err);
+  return ret;
+}
+void ParseLenTest() {
+  string data_path = rootPath + "/data/ekonchecker/";
+  const char *kinds[] = {"fail", "pass"};
+  const int counts[] = {23, 16};
+  for (int k = 0; k < 2; k++) {
+    for (int i = 1; i <= counts[k]; i++) {
+      stringstream ss;
+      ss << data_path << kinds[k] << i << ".ekon";
+      string json = Read(ss.str());
+      EkonAllocator *A = ekonAllocatorNew();
+      EkonValue *v = ekonValueNew(A);
+      char *err = NULL;
+      char *schema = NULL;
+      bool ret = ekonValueParseFast(v, json.c_str(), &err, &schema);
+      ekonAllocatorRelease(A);
+      free(err);
+      CheckRet(__func__, __LINE__, ss.str(), ParseSliceOne(json, "") == ret);
+      CheckRet(__func__, __LINE__, ss.str(),
+               ParseSliceOne(json, "\"x]}") == ret);
+    }
+  }
+  CheckRet(__func__, __LINE__, "[1, 2]", ParseSliceOne("[1, 2]", ", 3]"));
+  CheckRet(__func__, __LINE__, "{a: 1", !ParseSliceOne("{a: 1", "}"));
+  CheckRet(__func__, __LINE__, "'abc", !ParseSliceOne("'abc", "'"));
+  CheckRet(__func__, __LINE__, "tru", ParseSliceOne("tru", "e"));
+
+  // parsed strings are not terminated: written out, they end at their length
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  CheckRet(__func__, __LINE__, "[\"abc\", \"d\"]",
+           ekonValueParseLen(v, "[\"abc\", \"d\"]", 12, NULL, NULL) &&
+               string(ekonValueStringify(v, false)) == "[abc d]");
+  ekonAllocatorRelease(A);
+}
+
+// sources of 512 bytes and more go through the structural index. the same
+// values laid over its 64 byte blocks at every offset have to come out as
+// they do from sources too short for it. EKON only has line comments, a
+// "/* */" is text
+static const char *structuralParts[] = {
+    "[\"a\\\"b // no comment\", 'it\\'s /* no */ one']",
+    "{k: \"}\", 'q\\\\': [1, \"]\"], r: \"\\\\\"}",
+    "[1, // ] \" ' { /*\n 2, // */ ] }\n 3]",
+    "{b: \"x\\\"y\\\\\" // , c: ]\n}",
+    "[`tick`, \"`\", '\"', \"'\", a/b, 'c//d']"};
+string StructuralStringify(const string &json, string *schema) {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *sch = NULL;
+  string out = "error";
+  if (ekonValueParseLen(v, json.data(), json.size(), &err, &sch)) {
+    out.clear();
+    for (u32 i = 0; i < ekonValueSize(v); i++)
+      out += string(ekonValueStringify(ekonValueArrayGet(v, i), false)) + "|";
+  }
+  if (schema != NULL)
+    *schema = sch != NULL ? sch : "";
+  ekonAllocatorRelease(A);
+  free(err);
+  free(sch);
+  return out;
+}
+void StructuralTest() {
+  const int parts = sizeof(structuralParts) / sizeof(structuralParts[0]);
+  string expected;
+  for (int r = 0; r < 12; r++)
+    for (int i = 0; i < parts; i++)
+      expected +=
+          StructuralStringify(string("[") + structuralParts[i] + "]", NULL);
+  for (int shift = 0; shift < 64; shift++) {
+    const string schemaBody =
+        "{a: \"// \\\" ' /* x */\"}" + string(shift, ' ');
+    string json = "`" + schemaBody + "`\n[\n";
+    for (int r = 0; r < 12; r++)
+      for (int i = 0; i < parts; i++)
+        json += string((r * 13 + i * 7) % 64, ' ') + structuralParts[i] +
+                (r % 2 ? ",\n" : " // ,\n,");
+    json += "]";
+    string schema;
+    CheckRet(__func__, __LINE__, "shift " + to_string(shift),
+             json.size() >= 512 &&
+                 StructuralStringify(json, &schema) == expected &&
+                 schema == schemaBody);
+  }
+}
+
+// pass1.ekon fails on its "" key, EKON has no empty keys, and fail8.ekon
+// passes, alert() is an unquoted string. the first goes through the
+// structural index and the second does not, both have to keep their result
+// on the other side of EKON_STRUCTURAL_MIN_LEN
+string StructuralResult(const string &json) {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *sch = NULL;
+  string out = "error";
+  if (ekonValueParseLen(v, json.data(), json.size(), &err, &sch))
+    out = ekonValueStringify(v, false);
+  else if (err != NULL)
+    out = err;
+  ekonAllocatorRelease(A);
+  free(err);
+  free(sch);
+  return out;
+}
+void StructuralCheckerTest() {
+  const string pass1 = Read(rootPath + "/data/ekonchecker/pass1.ekon");
+  size_t end = 0;
+  for (int line = 0; line < 15 && end != string::npos; line++)
+    end = pass1.find('\n', end + (line != 0));
+  CheckRet(__func__, __LINE__, "pass1",
+           pass1.size() >= 512 && end < 512 &&
+               StructuralResult(pass1) == "15:10:Empty Key" &&
+               StructuralResult(pass1.substr(0, end)) == "15:10:Empty Key");
+
+  const string fail8 = Read(rootPath + "/data/ekonchecker/fail8.ekon");
+  CheckRet(__func__, __LINE__, "fail8",
+           fail8.size() < 512 &&
+               StructuralResult(fail8) ==
+                   "Illegal invocation:alert()" &&
+               StructuralResult(fail8 + string(512, ' ')) ==
+                   StructuralResult(fail8));
+}
+
+// the kind of every value, in one line: n<number> s'<string>' b<bool> null
+void LexDump(const EkonNode *n, string *out) {
+  for (; n != NULL; n = n->next) {
+    if (n->key != NULL)
+      *out += string(n->key, n->keyLen) + "=";
+    if (n->ekonType == EKON_TYPE_ARRAY || n->ekonType == EKON_TYPE_OBJECT) {
+      *out += n->ekonType == EKON_TYPE_ARRAY ? "[" : "{";
+      LexDump(n->value.node, out);
+      *out += n->ekonType == EKON_TYPE_ARRAY ? "]" : "}";
+    } else if (n->ekonType == EKON_TYPE_STRING) {
+      *out += "s'" + string(n->value.str, n->len) + "'";
+    } else if (n->ekonType == EKON_TYPE_NUMBER) {
+      *out += "n" + string(n->value.str, n->len);
+    } else if (n->ekonType == EKON_TYPE_BOOL) {
+      *out += "b" + string(n->value.str, n->len);
+    } else {
+      *out += "null";
+    }
+    *out += n->next != NULL ? " " : "";
+  }
+}
+// the dump of a source, or its error message. the options of the root value
+// go to outOption
+string LexParse(const char *s, size_t len, EkonOption *outOption) {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  string out;
+  if (ekonValueParseLen(v, s, len, &err, NULL)) {
+    LexDump(v->n, &out);
+    if (outOption != NULL)
+      *outOption = v->n->option;
+  } else {
+    out = string("error ") + err;
+  }
+  ekonAllocatorRelease(A);
+  free(err);
+  return out;
+}
+string LexOne(const string &json) {
+  return LexParse(json.data(), json.size(), NULL);
+}
+// the same from a copy in a buffer of its exact size with no '\0' after it,
+// so a read past the end shows under AddressSanitizer
+string LexExact(const string &json, EkonOption *outOption) {
+  char *buf = new char[json.size()];
+  json.copy(buf, json.size());
+  string out = LexParse(buf, json.size(), outOption);
+  delete[] buf;
+  return out;
+}
+// each token class of the lexer: keywords, words that only start like one
+// or like a number, slashes that are not comments, and where each misplaced
+// bracket, colon and comma is reported
+void LexerTest() {
+  const char *cases[][2] = {
+      {"[true, false, null, 'x', \"y\", `z`, 1, [], {}]",
+       "[btrue bfalse null s'x' s'y' s'`z`' n1 [] {}]"},
+      {"[nullable, trueish, falsey, nul, nulls, tru]",
+       "[s'nullable' s'trueish' s'falsey' s'nul' s'nulls' s'tru']"},
+      {"{nullable: 1, true: 2, null: 3, 1abc: 4}",
+       "{nullable=n1 true=n2 null=n3 1abc=n4}"},
+      {"true: 1", "{true=n1}"},
+      {"trueish", "s'trueish'"},
+      {"[1abc, -a, 0x, 1e, -0.5]", "[n1 s'abc' s'-a' s'0x' s'1e' n-0.5]"},
+      {"[a/b, 'c//d', a // c\n]", "[s'a/b' s'c//d' s'a']"},
+      {"[1] // c", "[n1]"},
+      {"[\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t 1, // a\n// b\n\r\n"
+       "                                  2] // end",
+       "[n1 n2]"},
+      {"[a /b]", "error 1:5:b"},
+      {"[/]", "error 1:3:0"},
+      {"[1, 2", "error 1:5:0"},
+      {"[1 2]]", "error 1:5:]"},
+      {"{a: [1}", "error 1:7:0"},
+      {"[1, {a: 2]]", "error 1:11:0"},
+      {"]", "error 1:0:]"},
+      {"}", "error 1:0:}"},
+      {"{a 1}", "error 1:3: "},
+      {"[:]", "error 1:2::"},
+      {"{:1}", "error 1:2::"},
+      {"{a:: 1}", "error 1:4::"},
+      {",", "error 1:1:0"},
+      {"[1,,2]", "error 1:4:,"},
+      {"{a: 1,, b: 2}", "error 1:7:,"},
+      {"[1] x", "error 1:4: "}};
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    CheckRet(__func__, __LINE__, cases[i][0],
+             LexOne(cases[i][0]) == cases[i][1]);
+}
+
+// every byte, alone and as the last byte after the start of each token class,
+// is read the same from a buffer of its exact size, from one with a '\0'
+// after it and from one with more text after it
+void LexerEdgeTest() {
+  CheckRet(__func__, __LINE__, "empty", LexExact("", NULL) == "error 1:0:0");
+  const char *prefixes[] = {"", "[", "[1, ", "{a", "{a: ", "a", "1", "-",
+                            "t", "nul", "false", "/", "// c"};
+  for (size_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++) {
+    for (int c = 0; c < 256; c++) {
+      const string json = prefixes[p] + string(1, (char)c);
+      const string sliced = json + "e]}\"x";
+      const string out = LexOne(json);
+      CheckRet(__func__, __LINE__, json,
+               LexExact(json, NULL) == out &&
+                   LexParse(sliced.data(), json.size(), NULL) == out);
+    }
+  }
+}
+
+// true, false and null, each prefix of them and each of them with a letter
+// after, ending right at the end of the source or followed by more text
+void KeywordTest() {
+  const char *keywords[] = {"true", "false", "null"};
+  const char *values[] = {"btrue", "bfalse", "null"};
+  for (int k = 0; k < 3; k++) {
+    const string word = keywords[k];
+    for (size_t n = 1; n <= word.size() + 1; n++) {
+      const string json = n <= word.size() ? word.substr(0, n) : word + "s";
+      const string value = n == word.size() ? values[k] : "s'" + json + "'";
+      const string sliced = json + "e, 1]";
+      const string open = "error 1:" + to_string(json.size() + 1) + ":0";
+      CheckRet(__func__, __LINE__, json,
+               LexExact(json, NULL) == value &&
+                   LexParse(sliced.data(), json.size(), NULL) == value &&
+                   LexExact("[" + json, NULL) == open &&
+                   LexExact("[1, " + json + "]", NULL) ==
+                       "[n1 " + value + "]" &&
+                   LexExact("{a: " + json + "}", NULL) == "{a=" + value + "}" &&
+                   LexExact(json + ": 1", NULL) == "{" + json + "=n1}");
+    }
+  }
+}
+
+// quoted strings of every length over two 32 byte blocks, ending right at the
+// end of the source, have the same value and options as with a '\0' after
+// them. unterminated ones fail the same way
+void StringEdgeTest() {
+  const char *bodies[] = {"abcdefgh", "ab cd ef", "ab\ncd\nef", "a\\\"b\\\\cd"};
+  const char quotes[] = {'\'', '\'', '\'', '"'};
+  for (int k = 0; k < 4; k++) {
+    for (int n = 0; n < 70; n++) {
+      string body;
+      for (int i = 0; i < n; i++)
+        body += bodies[k][i % 8];
+      const string q(1, quotes[k]);
+      EkonOption exact = 0, terminated = 0;
+      const bool open = body.size() > 0 && body[body.size() - 1] == '\\';
+      CheckRet(__func__, __LINE__, q + body + q,
+               LexExact(q + body + q, &exact) ==
+                       LexParse((q + body + q).c_str(), body.size() + 2,
+                                &terminated) &&
+                   exact == terminated &&
+                   (open || LexOne(q + body + q) == "s'" + body + "'"));
+      CheckRet(__func__, __LINE__, q + body,
+               LexExact(q + body, NULL).compare(0, 6, "error ") == 0);
+    }
+  }
+  CheckRet(__func__, __LINE__, "'a b'", LexExact("'a b'", NULL) == "s'a b'");
+  CheckRet(__func__, __LINE__, "\"ab\\", LexExact("\"ab\\", NULL) ==
+                                             "error 1:4:0");
+  CheckRet(__func__, __LINE__, "\"a\\nb\"",
+           LexExact("\"a\nb\"", NULL) == "error 1:2:a");
+  CheckRet(__func__, __LINE__, "'", LexExact("'", NULL) == "error 1:1:0");
+  CheckRet(__func__, __LINE__, "\"", LexExact("\"", NULL) == "error 1:1:0");
+}
+
+// feeding a source to the incremental parser in chunks of `step` bytes has to
+// agree with parsing it in one go
+bool ParseChunksOne(const string &json, size_t step, string *out) {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  EkonParser *p = ekonParserNew(v);
+  bool ret = true;
+  for (size_t i = 0; ret && i < json.size(); i += step) {
+    string chunk = json.substr(i, step);
+    ret = ekonParserFeed(p, chunk.data(), chunk.size(), &err, &schema);
+  }
+  if (ret)
+    ret = ekonParserFinish(p, &err, &schema);
+  if (ret && out != NULL)
+    *out = ekonValueStringify(v, false);
+  ekonAllocatorRelease(A);
+  free(err);
+  return ret;
+}
+void ParserTest() {
+  string data_path = rootPath + "/data/ekonchecker/";
+  const char *kinds[] = {"fail", "pass"};
+  const int counts[] = {23, 16};
+  for (int k = 0; k < 2; k++) {
+    for (int i = 1; i <= counts[k]; i++) {
+      stringstream ss;
+      ss << data_path << kinds[k] << i << ".ekon";
+      string json = Read(ss.str());
+      EkonAllocator *A = ekonAllocatorNew();
+      EkonValue *v = ekonValueNew(A);
+      char *err = NULL;
+      char *schema = NULL;
+      bool ret = ekonValueParseFast(v, json.c_str(), &err, &schema);
+      ekonAllocatorRelease(A);
+      free(err);
+      CheckRet(__func__, __LINE__, ss.str(),
+               ParseChunksOne(json, 1, NULL) == ret);
+      CheckRet(__func__, __LINE__, ss.str(),
+               ParseChunksOne(json, 7, NULL) == ret);
+    }
+  }
+  string out;
+  CheckRet(__func__, __LINE__, "{a: 'x\\u0041y', b: [true, 12]}",
+           ParseChunksOne("{a: 'x\\u0041y', b: [true, 12]}", 1, &out) &&
+               out == "a:x\\u0041y b:[true 12]");
+  CheckRet(__func__, __LINE__, "a: 1 // c\n b: null",
+           ParseChunksOne("a: 1 // c\n b: null", 2, &out) &&
+               out == "a:1 b:null");
+  CheckRet(__func__, __LINE__, "[1, 2,, 3]",
+           !ParseChunksOne("[1, 2,, 3]", 3, NULL));
+  CheckRet(__func__, __LINE__, "{a: 1", !ParseChunksOne("{a: 1", 1, NULL));
+
+  // keywords get their options set, whatever the arena held before. the
+  // allocator is filled with 0xFF and reset, so its nodes come out dirty
+  EkonAllocator *A = ekonAllocatorNew();
+  for (int k = 0; k < 2; k++) {
+    char *dirty = ekonAllocatorAlloc(A, 2048);
+    for (int i = 0; i < 2048; i++)
+      dirty[i] = (char)0xFF;
+    ekonAllocatorReset(A, EKON_RESET_KEEP_ALL);
+    EkonValue *v = ekonValueNew(A);
+    const char *doc = "[true, 12, null, 'x', false]";
+    bool ok;
+    if (k == 0) {
+      ok = ekonValueParseLen(v, doc, 28, NULL, NULL);
+    } else {
+      EkonParser *p = ekonParserNew(v);
+      ok = ekonParserFeed(p, doc, 28, NULL, NULL) &&
+           ekonParserFinish(p, NULL, NULL);
+    }
+    CheckRet(__func__, __LINE__, doc,
+             ok && string(ekonValueStringify(v, false)) ==
+                       "[true 12 null x false]" &&
+                 ekonValueArrayGet(v, 0)->n->option == 0 &&
+                 ekonValueArrayGet(v, 2)->n->option == 0 &&
+                 ekonValueArrayGet(v, 4)->n->option == 0);
+    ekonAllocatorReset(A, EKON_RESET_KEEP_ALL);
+  }
+  ekonAllocatorRelease(A);
+}
+
+// SAX callbacks that write one letter per event into a string
+bool SaxEvent(void *ctx, char c) {
+  *(string *)ctx += c;
+  return true;
+}
+bool SaxStartObject(void *ctx) { return SaxEvent(ctx, '{'); }
+bool SaxEndObject(void *ctx) { return SaxEvent(ctx, '}'); }
+bool SaxStartArray(void *ctx) { return SaxEvent(ctx, '['); }
+bool SaxEndArray(void *ctx) { return SaxEvent(ctx, ']'); }
+bool SaxKey(void *ctx, const char *key, u32 len, EkonOption option) {
+  *(string *)ctx += string(key, len) + ':';
+  return true;
+}
+bool SaxString(void *ctx, const char *s, u32 len, EkonOption option) {
+  return SaxEvent(ctx, 's');
+}
+bool SaxNumber(void *ctx, const char *s, u32 len, EkonOption option) {
+  return SaxEvent(ctx, 'n');
+}
+bool SaxBool(void *ctx, bool b) { return SaxEvent(ctx, b ? 't' : 'f'); }
+bool SaxNull(void *ctx) { return SaxEvent(ctx, '0'); }
+
+bool SaxParseOne(const string &json, string *out) {
+  EkonSaxHandler h = {out,       SaxStartObject, SaxEndObject, SaxStartArray,
+                      SaxEndArray, SaxKey,       SaxString,    SaxNumber,
+                      SaxBool,   SaxNull};
+  char *err = NULL;
+  char *schema = NULL;
+  out->clear();
+  bool ret = ekonSaxParseLen(json.c_str(), json.size(), &h, &err, &schema);
+  free(err);
+  free(schema);
+  return ret;
+}
+
+void SaxTest() {
+  string data_path = rootPath + "/data/ekonchecker/";
+  const char *kinds[] = {"fail", "pass"};
+  const int counts[] = {23, 16};
+  string out;
+  for (int k = 0; k < 2; k++) {
+    for (int i = 1; i <= counts[k]; i++) {
+      stringstream ss;
+      ss << data_path << kinds[k] << i << ".ekon";
+      string json = Read(ss.str());
+      EkonAllocator *A = ekonAllocatorNew();
+      EkonValue *v = ekonValueNew(A);
+      char *err = NULL;
+      char *schema = NULL;
+      bool ret = ekonValueParseFast(v, json.c_str(), &err, &schema);
+      ekonAllocatorRelease(A);
+      // duplicate keys are only caught while building the tree
+      if (ret == false && string(err).find("Duplicate") != string::npos)
+        ret = true;
+      free(err);
+      CheckRet(__func__, __LINE__, ss.str(), SaxParseOne(json, &out) == ret);
+    }
+  }
+  CheckRet(__func__, __LINE__, "{a: 'x', b: [true, 12, null, {}]}",
+           SaxParseOne("{a: 'x', b: [true, 12, null, {}]}", &out) &&
+               out == "{a:sb:[tn0{}]}");
+  CheckRet(__func__, __LINE__, "a: 1\n b: [x]",
+           SaxParseOne("a: 1\n b: [x]", &out) && out == "{a:nb:[s]}");
+  CheckRet(__func__, __LINE__, "[1, 2,, 3]", !SaxParseOne("[1, 2,, 3]", &out));
+}
+
+// value the cursor ends up at after looking up `path`, stringified. '#'
+// entries are array indices
+bool CursorOne(const string &json, const char *const *path, int n,
+               string *out) {
+  EkonCursor cur;
+  char *err = NULL;
+  char *schema = NULL;
+  bool ret = ekonCursorInit(&cur, json.c_str(), json.size(), &err, &schema);
+  for (int i = 0; ret && i < n; i++) {
+    if (path[i][0] == '#')
+      ret = ekonCursorArrayAt(&cur, atoi(path[i] + 1));
+    else
+      ret = ekonCursorFindField(&cur, path[i]);
+  }
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  if (ret)
+    ret = ekonCursorGet(&cur, v, &err);
+  if (ret)
+    *out = ekonValueStringify(v, false);
+  ekonAllocatorRelease(A);
+  free(err);
+  free(schema);
+  return ret;
+}
+
+void CursorTest() {
+  const string json = "{a: [1, {x: 'skip [me]'}, 3], // c\n"
+                      " b: {c: true, d: 'y'}, e: null}";
+  string out;
+  const char *p1[] = {"b", "d"};
+  CheckRet(__func__, __LINE__, "b.d",
+           CursorOne(json, p1, 2, &out) && out == "y");
+  const char *p2[] = {"a", "#2"};
+  CheckRet(__func__, __LINE__, "a[2]",
+           CursorOne(json, p2, 2, &out) && out == "3");
+  const char *p3[] = {"a", "#1"};
+  CheckRet(__func__, __LINE__, "a[1]",
+           CursorOne(json, p3, 2, &out) && out == "x:'skip [me]'");
+  const char *p4[] = {"e"};
+  CheckRet(__func__, __LINE__, "e",
+           CursorOne(json, p4, 1, &out) && out == "null");
+  const char *p5[] = {"c"};
+  CheckRet(__func__, __LINE__, "c", !CursorOne(json, p5, 1, &out));
+  const char *p6[] = {"a", "#3"};
+  CheckRet(__func__, __LINE__, "a[3]", !CursorOne(json, p6, 2, &out));
+  const char *p7[] = {"y"};
+  CheckRet(__func__, __LINE__, "root object without curly braces",
+           CursorOne("x: 1\ny: [2]", p7, 1, &out) && out == "[2]");
+  // a '\0' byte in a skipped value is an error, as it is for a parse
+  const char nul[][24] = {"{a: [\0], b: 1}", "{a: {\0}, b: 1}",
+                          "{a: \0, b: 1}", "{a: [1, \0 2], b: 1}"};
+  const size_t nulLen[] = {15, 15, 13, 20};
+  const char *p8[] = {"b"};
+  for (size_t i = 0; i < sizeof(nulLen) / sizeof(nulLen[0]); i++)
+    CheckRet(__func__, __LINE__, "'\\0' in a skipped value",
+             !CursorOne(string(nul[i], nulLen[i]), p8, 1, &out));
+}
+
+void DocStreamTest() {
+  const string json = "{a: 1}\n[2, 3] [4]\r\n'multi\nline'\n"
+                      "x: 1, y: [2,\n 3] // c\n[1,,2]\n{bad: \n'z'\n";
+  const char *expect[][2] = {{"{a: 1}", "a:1"},
+                             {"[2, 3]", "[2 3]"},
+                             {"[4]", "[4]"},
+                             {"'multi\nline'", "'multi\nline'"},
+                             {"x: 1, y: [2,\n 3] // c", "x:1 y:[2 3]"},
+                             {"[1,,2]", NULL},
+                             {"{bad: ", NULL},
+                             {"'z'", "z"}};
+  EkonDocStream *ds = ekonDocStreamNew(json.c_str(), json.size());
+  EkonValue *v;
+  u32 start, len;
+  char *schema = NULL;
+  int n = 0;
+  for (char *err = NULL;
+       ekonDocStreamNext(ds, &v, &start, &len, &err, &schema); err = NULL) {
+    free(err);
+    bool ok = n < 8 && json.substr(start, len) == expect[n][0];
+    if (ok && expect[n][1] == NULL)
+      ok = v == NULL;
+    else if (ok)
+      ok = v != NULL && string(ekonValueStringify(v, false)) == expect[n][1];
+    CheckRet(__func__, __LINE__, json.substr(start, len), ok);
+    n++;
+  }
+  CheckRet(__func__, __LINE__, "document count", n == 8);
+  ekonDocStreamRelease(ds);
+
+  // a '\0' byte spoils its own document, not the ones after it
+  const char nul[] = "[1, {\0}]\n[2, \0]\n{a:\n [\0\n]}\n[3]";
+  ds = ekonDocStreamNew(nul, sizeof(nul) - 1);
+  n = 0;
+  for (char *err = NULL;
+       ekonDocStreamNext(ds, &v, &start, &len, &err, &schema); err = NULL) {
+    CheckRet(__func__, __LINE__, "'\\0' in a document",
+             n < 6 && (v == NULL) == (err != NULL) && (v != NULL) == (n == 5));
+    free(err);
+    n++;
+  }
+  CheckRet(__func__, __LINE__, "documents after a '\\0'",
+           n == 6 && v != NULL &&
+               string(ekonValueStringify(v, false)) == "[3]");
+  ekonDocStreamRelease(ds);
+  free(schema);
+}
+
+// a parse with several threads has to agree with one without
+bool ParallelOne(const string &json, u32 threads, string *out) {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  bool ret = threads == 0
+                 ? ekonValueParseLen(v, json.data(), json.size(), &err, &schema)
+                 : ekonValueParseParallel(v, json.data(), json.size(), threads,
+                                          &err, &schema);
+  // the whole tree is too large to stringify here
+  stringstream ss;
+  if (ret) {
+    const u32 size = ekonValueSize(v);
+    ss << size;
+    for (u32 i = 0; i < size; i += 4999) {
+      stringstream key;
+      key << 'k' << i;
+      EkonValue *item = ekonValueArrayGet(v, i);
+      if (item == NULL)
+        item = ekonValueObjGet(v, key.str().c_str());
+      ss << ' ' << (item != NULL ? ekonValueStringify(item, false) : "-");
+    }
+    if (ekonValueObjGet(v, "k19999") != NULL)
+      ss << " k19999";
+  } else {
+    ss << err;
+  }
+  *out = ss.str();
+  ekonAllocatorRelease(A);
+  free(err);
+  free(schema);
+  return ret;
+}
+void ParallelTest() {
+  string arr = "`s` [", obj = "{";
+  // `1//c` sends the split past the structural index, to the lexer
+  string nul = "[1//c\n";
+  for (int i = 0; i < 20000; i++) {
+    stringstream ss;
+    ss << i;
+    arr += "{id: " + ss.str() + ", tags: ['a', b]} // c\n";
+    obj += "k" + ss.str() + ": [" + ss.str() + ", true],\n";
+    nul += i == 10000 ? string("{x: [\0]},\n", 10) : "[" + ss.str() + "],\n";
+  }
+  arr += "]";
+  nul += "]";
+  const string dup = obj + "k7: 1}";
+  obj += "}";
+  const string *jsons[] = {&arr, &obj, &dup, &nul};
+  for (int i = 0; i < 4; i++) {
+    string serial, parallel;
+    const bool ret = ParallelOne(*jsons[i], 0, &serial);
+    CheckRet(__func__, __LINE__, jsons[i]->substr(0, 20),
+             ParallelOne(*jsons[i], 4, &parallel) == ret &&
+                 parallel == serial);
+  }
+}
+
+void KeymapTest() {
+  string obj = "{";
+  for (int i = 0; i < 50000; i++) {
+    stringstream ss;
+    ss << i;
+    obj += "k" + ss.str() + ": " + ss.str() + ",\n";
+  }
+  obj += "}";
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  CheckRet(__func__, __LINE__, obj.substr(0, 20),
+           ekonValueParseFast(v, obj.c_str(), &err, &schema) == true);
+  // deleting keys must not cut the probes of the ones that are left
+  bool ok = true;
+  for (int i = 0; i < 50000; i += 2) {
+    stringstream ss;
+    ss << "k" << i;
+    ok = ok && ekonValueObjDel(v, ss.str().c_str()) == true;
+  }
+  for (int i = 0; i < 50000; i++) {
+    stringstream ss;
+    ss << "k" << i;
+    EkonValue *item = ekonValueObjGet(v, ss.str().c_str());
+    int n = -1;
+    if (i % 2 == 0)
+      ok = ok && item == 0;
+    else
+      ok = ok && item != 0 && ekonValueGetInt(item, &n) == true && n == i;
+  }
+  CheckRet(__func__, __LINE__, obj.substr(0, 20),
+           ok && ekonValueSize(v) == 25000);
+  // a copy indexes its keys on the first lookup
+  EkonValue *cp = ekonValueNew(A);
+  CheckRet(__func__, __LINE__, obj.substr(0, 20),
+           ekonValueCopyFrom(cp, v) == true &&
+               ekonValueObjGet(cp, "k49999") != 0 &&
+               ekonValueObjGet(cp, "k2") == 0);
+
+  // renamed and added members move in the keymap of their object
+  const char *eight = "{a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8}";
+  CheckRet(__func__, __LINE__, eight,
+           ekonValueParseFast(v, eight, &err, &schema) == true &&
+               ekonValueObjGet(v, "h") != 0);
+  EkonValue *a = ekonValueObjGet(v, "a"), *h = ekonValueObjGet(v, "h");
+  EkonValue *add = ekonValueNew(A);
+  int n1 = 0, n8 = 0, n9 = 0;
+  CheckRet(__func__, __LINE__, eight,
+           ekonValueSetKey(a, "alpha") == true &&
+               ekonValueSetKeyLen(h, "hotel-x", 5) == true &&
+               ekonValueSetNum(add, 9) == true &&
+               ekonValueSetKey(add, "india") == true &&
+               ekonValueObjAdd(v, add) == true);
+  CheckRet(__func__, __LINE__, eight,
+           ekonValueObjGet(v, "a") == 0 && ekonValueObjGet(v, "h") == 0 &&
+               ekonValueGetInt(ekonValueObjGet(v, "alpha"), &n1) == true &&
+               ekonValueGetInt(ekonValueObjGet(v, "hotel"), &n8) == true &&
+               ekonValueGetInt(ekonValueObjGet(v, "india"), &n9) == true &&
+               n1 == 1 && n8 == 8 && n9 == 9 &&
+               ekonValueObjGet(v, "b") != 0 && ekonValueSize(v) == 9);
+  // renaming a member leaves the options of its value alone
+  CheckRet(__func__, __LINE__, eight,
+           string(ekonValueStringify(v, false)) ==
+               "alpha:1 b:2 c:3 d:4 e:5 f:6 g:7 hotel:8 india:9");
+  // a member can take back a name that is free again
+  CheckRet(__func__, __LINE__, eight,
+           ekonValueSetKey(ekonValueObjGet(v, "alpha"), "h") == true &&
+               ekonValueGetInt(ekonValueObjGet(v, "h"), &n1) == true &&
+               n1 == 1 && ekonValueObjGet(v, "alpha") == 0 &&
+               ekonValueObjGet(v, "hotel") != 0);
+
+  // small objects have no keymap and are searched member by member
+  const char *small = "{a: 1, b: [], c: 3}";
+  CheckRet(__func__, __LINE__, small,
+           ekonValueParseFast(v, small, &err, &schema) == true &&
+               ekonValueObjDel(v, "b") == true &&
+               ekonValueObjGet(v, "a") != 0 && ekonValueObjGet(v, "b") == 0 &&
+               ekonValueObjGet(v, "c") != 0);
+  const char *dup = "{a: 1, b: {}, b: 3}";
+  CheckRet(__func__, __LINE__, dup,
+           ekonValueParseFast(v, dup, &err, &schema) == false);
+
+  // prepared keys, in objects with and without a keymap
+  const EkonKey c = ekonKeyPrepare("c", 1), k7 = ekonKeyPrepare("k7", 2);
+  CheckRet(__func__, __LINE__, small,
+           ekonValueParseFast(v, small, &err, &schema) == true &&
+               ekonValueObjGetPrepared(v, &c) != 0 &&
+               ekonValueObjDelPrepared(v, &c) == true &&
+               ekonValueObjGetPrepared(v, &c) == 0 && ekonValueSize(v) == 2);
+  CheckRet(__func__, __LINE__, obj.substr(0, 20),
+           ekonValueObjGetPrepared(cp, &k7) != 0 &&
+               ekonValueObjDelPrepared(cp, &k7) == true &&
+               ekonValueObjDelPrepared(cp, &k7) == false &&
+               ekonValueObjGet(cp, "k9") != 0);
+
+  // keys around the lengths where the hash changes how it reads the tail,
+  // next to keys that differ from them only in their first or last byte
+  const int lens[] = {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 24, 32, 33};
+  const string alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJ";
+  vector<string> keys;
+  for (size_t l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+    const string base = alphabet.substr(0, lens[l]);
+    string first = base, last = base;
+    first[0] = '_';
+    last[lens[l] - 1] = '-';
+    keys.push_back(base);
+    keys.push_back(first);
+    if (lens[l] > 1)
+      keys.push_back(last);
+  }
+  string tails = "{";
+  for (size_t k = 0; k < keys.size(); k++) {
+    stringstream ss;
+    ss << "'" << keys[k] << "': " << k << "\n";
+    tails += ss.str();
+  }
+  tails += "}";
+  ok = ekonValueParseFast(v, tails.c_str(), &err, &schema) == true;
+  for (size_t k = 0; k < keys.size(); k++) {
+    const EkonKey pk = ekonKeyPrepare(keys[k].c_str(), keys[k].size());
+    int n = -1;
+    ok = ok && ekonValueGetInt(ekonValueObjGet(v, keys[k].c_str()), &n) &&
+         n == (int)k && ekonValueObjGetPrepared(v, &pk) != 0;
+    string other = keys[k];
+    other[other.size() / 2] = '#';
+    ok = ok && ekonValueObjGet(v, other.c_str()) == 0 &&
+         ekonValueObjGet(v, (keys[k] + "#").c_str()) == 0;
+  }
+  const EkonKey empty = ekonKeyPrepare("", 0);
+  CheckRet(__func__, __LINE__, tails.substr(0, 20),
+           ok && ekonValueObjGet(v, "") == 0 &&
+               ekonValueObjGetPrepared(v, &empty) == 0);
+
+  // two keys with the same 32 bit hash are still told apart by their bytes
+  vector<int> seen(1 << 21, -1);
+  vector<u32> hashes;
+  int x = -1, y = -1;
+  for (int i = 0; y < 0 && i < (1 << 20); i++) {
+    stringstream ss;
+    ss << "c" << i;
+    const string key = ss.str();
+    hashes.push_back(ekonKeyPrepare(key.c_str(), key.size()).hash);
+    u32 slot = hashes[i] & ((1 << 21) - 1);
+    while (seen[slot] >= 0 && hashes[seen[slot]] != hashes[i])
+      slot = (slot + 1) & ((1 << 21) - 1);
+    if (seen[slot] >= 0) {
+      x = seen[slot];
+      y = i;
+    }
+    seen[slot] = i;
+  }
+  stringstream collide;
+  collide << "{a: 0, b: 0, d: 0, e: 0, f: 0, g: 0, h: 0, i: 0, c" << x
+          << ": 1, c" << y << ": 2}";
+  const string cs = collide.str();
+  int n2 = -1;
+  CheckRet(__func__, __LINE__, cs,
+           y >= 0 && ekonValueParseFast(v, cs.c_str(), &err, &schema) == true);
+  stringstream cx, cy;
+  cx << "c" << x;
+  cy << "c" << y;
+  CheckRet(__func__, __LINE__, cs,
+           ekonValueGetInt(ekonValueObjGet(v, cx.str().c_str()), &n1) &&
+               ekonValueGetInt(ekonValueObjGet(v, cy.str().c_str()), &n2) &&
+               n1 == 1 && n2 == 2 &&
+               ekonValueObjDel(v, cx.str().c_str()) == true &&
+               ekonValueObjGet(v, cx.str().c_str()) == 0 &&
+               ekonValueGetInt(ekonValueObjGet(v, cy.str().c_str()), &n2) &&
+               n2 == 2);
+
+  // ekonValueObjAdd and ekonValueSetKey take a key the object has already.
+  // a lookup finds the last member with it, with a keymap or without one
+  const char *repeated = "{a: 0, b: 0, c: 0, d: 1, e: 0,"
+                         " f: 0, g: 0, h: 0, i: 0}";
+  EkonValue *d2 = ekonValueNew(A);
+  n2 = -1;
+  CheckRet(__func__, __LINE__, repeated,
+           ekonValueParseFast(v, repeated, &err, &schema) == true &&
+               ekonValueSetNum(d2, 2) && ekonValueSetKey(d2, "d") &&
+               ekonValueObjAdd(v, d2) &&
+               ekonValueGetInt(ekonValueObjGet(v, "d"), &n2) && n2 == 2 &&
+               ekonValueObjDel(v, "d") && ekonValueObjGet(v, "d") != NULL &&
+               ekonValueGetInt(ekonValueObjGet(v, "d"), &n2) && n2 == 1);
+  const char *const pool[] = {"a", "b", "c", "d", "e", "f",
+                              "g", "h", "i", "j", "k", "l"};
+  u32 seed = 12345;
+  ok = true;
+  for (int round = 0; round < 60 && ok; round++) {
+    ok = ekonValueParseFast(v, "{}", &err, &schema);
+    vector<string> keys;
+    vector<int> values;
+    for (int op = 0; op < 10 + round * 5 && ok; op++) {
+      seed = seed * 1103515245 + 12345;
+      const u32 r = seed >> 8;
+      const string key = pool[r % 12];
+      int at = -1;
+      for (int k = 0; k < (int)keys.size(); k++)
+        if (keys[k] == key)
+          at = k;
+      if ((r / 12) % 4 <= 1) {
+        EkonValue *item = ekonValueNew(A);
+        ok = ekonValueSetNum(item, op) && ekonValueSetKey(item, key.c_str()) &&
+             ekonValueObjAdd(v, item);
+        keys.push_back(key);
+        values.push_back(op);
+      } else if ((r / 12) % 4 == 2) {
+        ok = ekonValueObjDel(v, key.c_str()) == (at >= 0);
+        if (at >= 0) {
+          keys.erase(keys.begin() + at);
+          values.erase(values.begin() + at);
+        }
+      } else {
+        EkonValue *item = ekonValueObjGet(v, key.c_str());
+        ok = (item != NULL) == (at >= 0);
+        if (ok && at >= 0) {
+          keys[at] = pool[(r / 48) % 12];
+          ok = ekonValueSetKey(item, keys[at].c_str());
+        }
+      }
+      for (int p = 0; p < 12 && ok; p++) {
+        at = -1;
+        for (int k = 0; k < (int)keys.size(); k++)
+          if (keys[k] == pool[p])
+            at = k;
+        EkonValue *item = ekonValueObjGet(v, pool[p]);
+        n2 = -1;
+        ok = at < 0 ? item == NULL
+                    : item != NULL && ekonValueGetInt(item, &n2) &&
+                          n2 == values[at];
+      }
+      ok = ok && ekonValueSize(v) == keys.size();
+    }
+  }
+  CheckRet(__func__, __LINE__, "repeated keys", ok);
+  ekonAllocatorRelease(A);
+  free(err);
+  free(schema);
+}
+
+void KeyTableTest() {
+  EkonKeyTable *t = ekonKeyTableNew(64);
+  EkonAllocator *A = ekonAllocatorNew();
+  ekonAllocatorSetKeyTable(A, t);
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  const char *doc = "{id: 1, name: x, tags: {id: 2, size: 3}}";
+  CheckRet(__func__, __LINE__, doc,
+           ekonValueParseFast(v, doc, &err, &schema) == true);
+  // the same key gets the same id in every object
+  EkonValue *tags = ekonValueObjGet(v, "tags");
+  const u32 id = ekonKeyTableFind(t, "id", 2);
+  CheckRet(__func__, __LINE__, doc,
+           id != 0 && ekonValueGetKeyId(ekonValueObjGet(v, "id")) == id &&
+               ekonValueGetKeyId(ekonValueObjGet(tags, "id")) == id &&
+               ekonValueGetKeyId(ekonValueObjGet(tags, "size")) ==
+                   ekonKeyTableFind(t, "size", 4));
+  const char *dup = "{id: 1, name: x, id: 3}";
+  CheckRet(__func__, __LINE__, dup,
+           ekonValueParseFast(v, dup, &err, &schema) == false);
+
+  // a frozen table learns no keys, the others are still parsed
+  ekonKeyTableFreeze(t);
+  const char *more = "{id: 1, other: 2}";
+  CheckRet(__func__, __LINE__, more,
+           ekonValueParseFast(v, more, &err, &schema) == true &&
+               ekonValueGetKeyId(ekonValueObjGet(v, "id")) == id &&
+               ekonValueGetKeyId(ekonValueObjGet(v, "other")) == 0 &&
+               ekonKeyTableAdd(t, "other", 5) == 0);
+  const char *mixed = "{other: 1, id: 2, other: 3}";
+  CheckRet(__func__, __LINE__, mixed,
+           ekonValueParseFast(v, mixed, &err, &schema) == false);
+
+  EkonKeyTable *seeded = ekonKeyTableNew(64);
+  CheckRet(__func__, __LINE__, doc, ekonKeyTableAddKeys(seeded, tags) == 3);
+  ekonKeyTableRelease(seeded);
+  ekonAllocatorRelease(A);
+  ekonKeyTableRelease(t);
+  free(err);
+  free(schema);
+}
+
+void ParseOptionsTest() {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  EkonParseOptions o = EkonParseOptions();
+  o.allowDuplicateKeys = true;
+  const char *dup = "{a: 1, b: 2, a: 3}";
+  int n = 0;
+  CheckRet(__func__, __LINE__, dup,
+           ekonValueParseEx(v, dup, 18, &o, &err, &schema) == true &&
+               ekonValueGetInt(ekonValueObjGet(v, "a"), &n) == true && n == 3);
+
+  o = EkonParseOptions();
+  o.maxDepth = 2;
+  CheckRet(__func__, __LINE__, "maxDepth",
+           ekonValueParseEx(v, "{a: [1]}", 8, &o, &err, &schema) == true &&
+               ekonValueParseEx(v, "[[[1]]]", 7, &o, NULL, NULL) == false);
+  o = EkonParseOptions();
+  o.maxValues = 3;
+  o.maxLen = 16;
+  CheckRet(__func__, __LINE__, "maxValues",
+           ekonValueParseEx(v, "[1, [2]]", 8, &o, &err, &schema) == true &&
+               ekonValueParseEx(v, "[1, 2, 3, 4]", 12, &o, NULL, NULL) ==
+                   false &&
+               ekonValueParseEx(v, "[1, 2, 3, 4, 5, 6]", 18, &o, NULL, NULL) ==
+                   false);
+
+  o = EkonParseOptions();
+  o.skipSchema = true;
+  o.numbers = EKON_NUMBERS_EAGER;
+  const char *doc = "`schema`\n{a: 1.5}";
+  CheckRet(__func__, __LINE__, doc,
+           ekonValueParseEx(v, doc, 17, &o, &err, &schema) == true &&
+               schema == NULL &&
+               (ekonValueObjGet(v, "a")->n->option & EKON_IS_NUM_CACHED) != 0);
+  ekonAllocatorRelease(A);
+  free(err);
+}
+
+#if EKON_MEMORY_NODE == 2
+// a document that fits the allocator's first block is parsed without going to
+// the heap: no key copies, no message or schema strings
+void ZeroAllocTest() {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  const char doc[] = "`{id: 'number'}`\n{id: 1, name: ekon, tags: [a, b], "
+                     "lat: 23.75, lon: 90.38, size: 42, ok: true, type: x, "
+                     "url: 'http://a.b', next: null}";
+  EkonParseOptions o = EkonParseOptions();
+  o.skipSchema = true;
+  o.numbers = EKON_NUMBERS_EAGER;
+  u32 count, size, freed, after;
+  ekonMemoryStats(&count, &size, &freed);
+  const bool ok =
+      ekonValueParseEx(v, doc, sizeof(doc) - 1, &o, NULL, NULL) == true;
+  ekonMemoryStats(&after, &size, &freed);
+  CheckRet(__func__, __LINE__, doc,
+           ok && after == count && ekonValueObjGet(v, "next") != NULL);
+  ekonAllocatorRelease(A);
+}
+#endif
+
+// a document parsed again and again from an allocator that is reset in
+// between, with each policy. keeping every block, a second parse of the same
+// document takes nothing from the heap
+void AllocatorResetTest() {
+  stringstream ss;
+  ss << "[";
+  for (int i = 0; i < 1000; i++)
+    ss << "{id: " << i << ", name: item" << i << "}\n";
+  ss << "]";
+  const string doc = ss.str();
+  const EkonResetPolicy policies[3] = {
+      EKON_RESET_KEEP_LARGEST, EKON_RESET_KEEP_ALL, EKON_RESET_KEEP_FIRST};
+  EkonAllocator *A = ekonAllocatorNew();
+  for (int p = 0; p < 3; p++) {
+    for (int r = 0; r < 3; r++) {
+#if EKON_MEMORY_NODE == 2
+      u32 count, size, freed, after;
+      ekonMemoryStats(&count, &size, &freed);
+#endif
+      EkonValue *v = ekonValueNew(A);
+      int n = 0;
+      CheckRet(__func__, __LINE__, "reset",
+               ekonValueParseLen(v, doc.c_str(), (u32)doc.size(), NULL,
+                                 NULL) == true &&
+                   ekonValueSize(v) == 1000 &&
+                   ekonValueGetInt(ekonValueObjGet(ekonValueArrayGet(v, 999),
+                                                   "id"),
+                                   &n) == true &&
+                   n == 999);
+#if EKON_MEMORY_NODE == 2
+      ekonMemoryStats(&after, &size, &freed);
+      if (policies[p] == EKON_RESET_KEEP_ALL && r > 0)
+        CheckRet(__func__, __LINE__, "reset: no malloc", after == count);
+#endif
+      ekonAllocatorReset(A, policies[p]);
+    }
+  }
+
+  // the setters keep a scratch string in the allocator, which a reset hands
+  // out again with the rest of its memory
+  const char *small = "{a: 1, b: [x, y, z], c: 'a longer string here'}";
+  for (int p = 0; p < 3; p++) {
+    for (int r = 0; r < 5; r++) {
+      EkonValue *v = ekonValueNew(A), *add = ekonValueNew(A);
+      char *err = NULL, *schema = NULL;
+      const char *out = NULL;
+      if (ekonValueParse(v, small, &err, &schema) &&
+          ekonValueSetStrLen(add, "hello world", 11) &&
+          ekonValueSetKeyLen(add, "k", 1) && ekonValueObjAdd(v, add))
+        out = ekonValueStringify(v, false);
+      CheckRet(__func__, __LINE__, "reset: setters",
+               out != NULL && string(out) == "a:1 b:[x y z] "
+                                             "c:'a longer string here'"
+                                             "k:'hello world'");
+      free(err);
+      free(schema);
+      ekonAllocatorReset(A, policies[p]);
+    }
+  }
+  ekonAllocatorRelease(A);
+}
 
 void RoundTripTest() {
   string data_path = rootPath + "data/roundtrip/roundtrip";
@@ -117,8 +1145,7 @@ void DoubleTestOne(const string &s, double e) {
   CheckRet(__func__, __LINE__, s.c_str(), vv != 0);
 
   double d = 0.0;
-  ekonValueGetNum(vv, &d);
-  CheckRet(__func__, __LINE__, s.c_str(), d != 0);
+  CheckRet(__func__, __LINE__, s.c_str(), ekonValueGetNum(vv, &d) == true);
   CheckRet(__func__, __LINE__, s.c_str(), e == d);
   ekonAllocatorRelease(A);
   delete err;
@@ -132,6 +1159,11 @@ void DoubleTest() {
   TEST_DOUBLE("[1.5]", 1.5);
   TEST_DOUBLE("[-1.5]", -1.5);
   TEST_DOUBLE("[3.1416]", 3.1416);
+  TEST_DOUBLE("[.5]", 0.5);
+  TEST_DOUBLE("[-.5]", -0.5);
+  TEST_DOUBLE("[5.]", 5.0);
+  TEST_DOUBLE("[+1_000.2_5e1_0]", 1000.25e10);
+  TEST_DOUBLE("[0x1_0000_0000_0000_0001]", 18446744073709551616.0);
   TEST_DOUBLE("[1E10]", 1E10);
   TEST_DOUBLE("[1e10]", 1e10);
   TEST_DOUBLE("[1E+10]", 1E+10);
@@ -281,12 +1313,141 @@ void DoubleTest() {
               "e-308]",
               2.2250738585072014e-308);
 }
+// the digits past the 19th that Eisel-Lemire cannot round alone take a slow
+// path. it has to read a '.' whatever decimal point the locale has
+void DoubleLocaleTest() {
+  const string saved = setlocale(LC_NUMERIC, NULL);
+  const char *commas[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE", "fr_FR.UTF-8",
+                          "German"};
+  for (size_t i = 0; i < sizeof(commas) / sizeof(commas[0]); i++)
+    if (setlocale(LC_NUMERIC, commas[i]) != NULL)
+      break;
+  TEST_DOUBLE("[0.999999999999999944488848768742172978818416595458984374]",
+              0.99999999999999989);
+  TEST_DOUBLE("[1.00000000000000011102230246251565404236316680908203126]",
+              1.00000000000000022);
+  TEST_DOUBLE("[7205759403792793199999e-5]", 72057594037927928.0);
+  TEST_DOUBLE("[2.22507385850720113605740979670913197593481954635164565e-308]",
+              2.2250738585072014e-308);
+  setlocale(LC_NUMERIC, saved.c_str());
+}
+void NumberTest() {
+  EkonAllocator *A = ekonAllocatorNew();
+  EkonValue *v = ekonValueNew(A);
+  char *err = NULL;
+  char *schema = NULL;
+  const char *json = "[42, -0x1F, 0b101, 0o17, 1_000, 9223372036854775807, "
+                     "-1234567890_12345678, -2.5, 18446744073709551616]";
+  CheckRet(__func__, __LINE__, json,
+           ekonValueParseFast(v, json, &err, &schema) == true);
+  const long long expect[] = {42, -31, 5, 15, 1000, 9223372036854775807LL,
+                              -123456789012345678LL};
+  for (u32 i = 0; i < 7; i++) {
+    EkonValue *item = ekonValueArrayGet(v, i);
+    long long ll = 0, again = 0;
+    CheckRet(__func__, __LINE__, json,
+             ekonValueGetLongLong(item, &ll) == true && ll == expect[i]);
+    // the second read comes from the node
+    CheckRet(__func__, __LINE__, json,
+             (item->n->option & EKON_IS_NUM_CACHED) != 0 &&
+                 ekonValueGetLongLong(item, &again) == true && again == ll);
+  }
+  int i = 0;
+  double d = 0;
+  EkonValue *item = ekonValueArrayGet(v, 7);
+  CheckRet(__func__, __LINE__, json,
+           ekonValueGetInt(item, &i) == true && i == -2);
+  CheckRet(__func__, __LINE__, json,
+           ekonValueGetInt(ekonValueArrayGet(v, 5), &i) == false);
+  item = ekonValueArrayGet(v, 8);
+  CheckRet(__func__, __LINE__, json,
+           ekonValueGetNum(item, &d) == true &&
+               d == 18446744073709551616.0);
+  // a whole array at once, up to the first element that does not fit
+  i64 ints[16];
+  double doubles[16];
+  CheckRet(__func__, __LINE__, json,
+           ekonValueArrayGetInt64s(v, ints, 16) == 8 && ints[7] == -2);
+  for (u32 k = 0; k < 7; k++)
+    CheckRet(__func__, __LINE__, json, ints[k] == expect[k]);
+  CheckRet(__func__, __LINE__, json,
+           ekonValueArrayGetDoubles(v, doubles, 16) == 9 &&
+               doubles[1] == -31 && doubles[7] == -2.5 &&
+               doubles[8] == 18446744073709551616.0);
+  CheckRet(__func__, __LINE__, json,
+           ekonValueArrayGetDoubles(v, doubles, 2) == 2);
+  // integers just past either end of an i64 do not fit, though the doubles
+  // of the ones below INT64_MIN round to it
+  const char *edges[] = {"[-9223372036854775809]", "[-9223372036854776147]",
+                         "[9223372036854775808]"};
+  for (u32 k = 0; k < 3; k++) {
+    EkonValue *edge = ekonValueNew(A);
+    long long ll = 0;
+    long l = 0;
+    CheckRet(__func__, __LINE__, edges[k],
+             ekonValueParseFast(edge, edges[k], NULL, NULL) == true &&
+                 ekonValueArrayGetInt64s(edge, ints, 16) == 0 &&
+                 ekonValueGetLongLong(ekonValueArrayGet(edge, 0), &ll) ==
+                     false &&
+                 ekonValueGetLong(ekonValueArrayGet(edge, 0), &l) == false &&
+                 ekonValueGetNum(ekonValueArrayGet(edge, 0), &d) == true);
+  }
+  EkonValue *edge = ekonValueNew(A);
+  long long ll = 0;
+  CheckRet(__func__, __LINE__, "INT64_MIN",
+           ekonValueParseFast(edge, "[-9223372036854775808]", NULL, NULL) &&
+               ekonValueArrayGetInt64s(edge, ints, 16) == 1 &&
+               ekonValueGetLongLong(ekonValueArrayGet(edge, 0), &ll) &&
+               ll == -9223372036854775807LL - 1);
+  // setters replace the cached number
+  ekonValueSetInt(item, 7);
+  CheckRet(__func__, __LINE__, json,
+           ekonValueGetNum(item, &d) == true && d == 7);
+  ekonValueSetNumStr(item, "0x10");
+  CheckRet(__func__, __LINE__, json,
+           ekonValueGetInt(item, &i) == true && i == 16);
+  // and write the shortest text that reads back the same number
+  const double shortest[] = {0.1, 1e21, 2.5e-7, -0.0, 123456.789, 5e-324};
+  const char *texts[] = {"0.1", "1e21", "2.5e-7", "-0", "123456.789", "5e-324"};
+  for (u32 k = 0; k < 6; k++) {
+    ekonValueSetNum(item, shortest[k]);
+    CheckRet(__func__, __LINE__, texts[k],
+             string(ekonValueStringify(item, false)) == texts[k]);
+  }
+  ekonValueSetLongLong(item, -9223372036854775807LL - 1);
+  CheckRet(__func__, __LINE__, json,
+           string(ekonValueStringify(item, false)) == "-9223372036854775808");
+  ekonAllocatorRelease(A);
+  free(err);
+  free(schema);
+}
 int main() {
   printf("==================%s==================\n", "conformance_test");
   EKONCheckerTest();
+  ParseLenTest();
+  StructuralTest();
+  StructuralCheckerTest();
+  LexerTest();
+  LexerEdgeTest();
+  StringEdgeTest();
+  KeywordTest();
+  ParserTest();
+  SaxTest();
+  CursorTest();
+  DocStreamTest();
+  ParallelTest();
+  KeymapTest();
+  KeyTableTest();
+  ParseOptionsTest();
+  AllocatorResetTest();
+#if EKON_MEMORY_NODE == 2
+  ZeroAllocTest();
+#endif
   /* RoundTripTest(); */
   /* StringTest(); */
-  /* DoubleTest(); */
+  DoubleTest();
+  DoubleLocaleTest();
+  NumberTest();
   /* PrintResult(); */
   return 0;
 }